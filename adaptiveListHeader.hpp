@@ -0,0 +1,136 @@
+#ifndef ADAPTIVE_LIST_H
+#define ADAPTIVE_LIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "listHeader.hpp"
+
+#ifndef ADAPTIVE_LIST_WINDOW
+#define ADAPTIVE_LIST_WINDOW 256
+#endif
+
+#ifndef ADAPTIVE_LIST_MIN_LINKED_SIZE
+#define ADAPTIVE_LIST_MIN_LINKED_SIZE 64
+#endif
+
+template <typename T>
+class AdaptiveList {
+private:
+    List<T> linked;
+    std::vector<T> contiguous;
+    bool linked_mode;
+    std::size_t structural_ops;
+    std::size_t sequential_ops;
+
+    void record_structural();
+    void record_sequential();
+    bool should_switch() const;
+    void maybe_switch();
+    void to_linked();
+    void to_contiguous();
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator(AdaptiveList*, typename List<T>::iterator, size_type);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator& operator--();
+        iterator operator++(int);
+        iterator operator--(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+        friend class AdaptiveList<T>;
+    private:
+        AdaptiveList* owner;
+        typename List<T>::iterator node;
+        size_type index;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = const T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator(const AdaptiveList*, typename List<T>::const_iterator, size_type);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int);
+        const_iterator operator--(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+    private:
+        const AdaptiveList* owner;
+        typename List<T>::const_iterator node;
+        size_type index;
+    };
+
+    AdaptiveList();
+    AdaptiveList(std::initializer_list<T>);
+    AdaptiveList(const AdaptiveList&) = delete;
+    AdaptiveList& operator=(const AdaptiveList&) = delete;
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+    reference operator[](size_type);
+    const_reference operator[](size_type) const;
+    reference at(size_type);
+    const_reference at(size_type) const;
+
+    void push_back(const T&);
+    void push_back(T&&);
+    void push_front(const T&);
+    void push_front(T&&);
+
+    template<typename... Args>
+    reference emplace_back(Args&&...);
+
+    void pop_back();
+    void pop_front();
+    iterator insert(iterator, const T&);
+    iterator insert(iterator, T&&);
+    iterator erase(iterator);
+    void clear();
+
+    iterator begin();
+    iterator end();
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    size_type getSize() const;
+    bool empty() const;
+    bool is_contiguous() const;
+    void make_contiguous();
+    void make_linked();
+
+private:
+    iterator maybe_switch(iterator);
+};
+
+#include "adaptiveListImplementation.tpp"
+
+#endif
@@ -0,0 +1,809 @@
+#include "adaptiveListHeader.hpp"
+
+/**
+ * @brief Counts an operation that is cheap on linked nodes but shifts elements in a vector.
+ */
+template <typename T>
+void AdaptiveList<T>::record_structural() {
+    ++structural_ops;
+}
+
+/**
+ * @brief Counts an operation that favours contiguous storage: an append, an index access or one step of a scan.
+ *
+ * Only non-const access is counted. Reads through a const list write nothing, so concurrent
+ * readers of a shared const list are as safe as with `List`.
+ */
+template <typename T>
+void AdaptiveList<T>::record_sequential() {
+    ++sequential_ops;
+}
+
+/**
+ * @brief Decides whether the operations counted so far call for the other representation.
+ *
+ * The list becomes linked when more than a quarter of the counted operations were middle or
+ * front edits on a list of at least `ADAPTIVE_LIST_MIN_LINKED_SIZE` elements, and becomes
+ * contiguous again only when fewer than one in sixteen were. The gap between the two thresholds
+ * keeps a mixed workload from converting back and forth on every window.
+ *
+ * @return true if the representation should change.
+ */
+template <typename T>
+bool AdaptiveList<T>::should_switch() const {
+    std::size_t total = structural_ops + sequential_ops;
+    if (linked_mode) {
+        return structural_ops * 16 < total;
+    }
+    return structural_ops * 4 > total && contiguous.size() >= ADAPTIVE_LIST_MIN_LINKED_SIZE;
+}
+
+/**
+ * @brief Re-evaluates the representation once a full window of operations has been observed.
+ */
+template <typename T>
+void AdaptiveList<T>::maybe_switch() {
+    if (structural_ops + sequential_ops < ADAPTIVE_LIST_WINDOW) {
+        return;
+    }
+    if (should_switch()) {
+        if (linked_mode) {
+            to_contiguous();
+        }
+        else {
+            to_linked();
+        }
+    }
+    structural_ops = 0;
+    sequential_ops = 0;
+}
+
+/**
+ * @brief Re-evaluates the representation after an edit at `pos`, carrying `pos` across a switch.
+ *
+ * The position is converted to an index and back only when a conversion actually happens. That
+ * walk is O(n), but so is the conversion it accompanies; a window that keeps the representation
+ * costs nothing extra.
+ *
+ * @param pos A valid position in the current representation.
+ * @return The same position in the representation in use afterwards.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator AdaptiveList<T>::maybe_switch(iterator pos) {
+    if (structural_ops + sequential_ops < ADAPTIVE_LIST_WINDOW || !should_switch()) {
+        maybe_switch();
+        return pos;
+    }
+    size_type index = linked_mode ? static_cast<size_type>(std::distance(linked.begin(), pos.node)) : pos.index;
+    maybe_switch();
+    if (linked_mode) {
+        return iterator(this, std::next(linked.begin(), static_cast<difference_type>(index)), 0);
+    }
+    return iterator(this, linked.end(), index);
+}
+
+/**
+ * @brief Moves every element from the vector into linked nodes and releases the vector's buffer.
+ *
+ * The nodes are built in a separate list that replaces the vector only once every element is in
+ * place. If a node allocation throws, the elements already moved are moved back, so the list is
+ * left contiguous and unchanged. Elements whose move may throw are copied instead, as with
+ * `std::vector` growth.
+ */
+template <typename T>
+void AdaptiveList<T>::to_linked() {
+    List<T> nodes;
+    try {
+        for (T& value : contiguous) {
+            nodes.emplace_back(std::move_if_noexcept(value));
+        }
+    }
+    catch (...) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            auto slot = contiguous.begin();
+            for (T& value : nodes) {
+                *slot = std::move(value);
+                ++slot;
+            }
+        }
+        throw;
+    }
+    linked = std::move(nodes);
+    std::vector<T>().swap(contiguous);
+    linked_mode = true;
+}
+
+/**
+ * @brief Moves every element from the linked nodes into the vector, freeing each node as it goes.
+ */
+template <typename T>
+void AdaptiveList<T>::to_contiguous() {
+    linked.move_into(contiguous);
+    linked_mode = false;
+}
+
+/**
+ * @brief Constructor for an iterator over either representation.
+ *
+ * @param list The list the iterator belongs to.
+ * @param it The node position, used while the list is linked.
+ * @param pos The element index, used while the list is contiguous.
+ */
+template <typename T>
+AdaptiveList<T>::iterator::iterator(AdaptiveList* list, typename List<T>::iterator it, size_type pos)
+    : owner(list), node(it), index(pos) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A reference to the current element.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator::reference AdaptiveList<T>::iterator::operator*() const {
+    if (owner->linked_mode) {
+        typename List<T>::iterator it = node;
+        return *it;
+    }
+    return owner->contiguous[index];
+}
+
+/**
+ * @brief Arrow operator for iterator.
+ *
+ * @return A pointer to the current element.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator::pointer AdaptiveList<T>::iterator::operator->() const {
+    return &**this;
+}
+
+/**
+ * @brief Prefix increment operator for iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator& AdaptiveList<T>::iterator::operator++() {
+    owner->record_sequential();
+    if (owner->linked_mode) {
+        ++node;
+    }
+    else {
+        ++index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for iterator.
+ *
+ * `List` iterators cannot step back from `end()`, so in linked mode that step goes straight to
+ * the list's last live node.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator& AdaptiveList<T>::iterator::operator--() {
+    owner->record_sequential();
+    if (owner->linked_mode) {
+        if (node == owner->linked.end()) {
+            node = typename List<T>::iterator(List<T>::live_backward(owner->linked.tail));
+        }
+        else {
+            --node;
+        }
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator AdaptiveList<T>::iterator::operator++(int) {
+    iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator AdaptiveList<T>::iterator::operator--(int) {
+    iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators reference the same position, false otherwise.
+ */
+template <typename T>
+bool AdaptiveList<T>::iterator::operator==(const iterator& other) const {
+    return node == other.node && index == other.index;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators reference different positions, false otherwise.
+ */
+template <typename T>
+bool AdaptiveList<T>::iterator::operator!=(const iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructor for a const iterator over either representation.
+ *
+ * @param list The list the iterator belongs to.
+ * @param it The node position, used while the list is linked.
+ * @param pos The element index, used while the list is contiguous.
+ */
+template <typename T>
+AdaptiveList<T>::const_iterator::const_iterator(const AdaptiveList* list, typename List<T>::const_iterator it, size_type pos)
+    : owner(list), node(it), index(pos) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return A const reference to the current element.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_iterator::reference AdaptiveList<T>::const_iterator::operator*() const {
+    if (owner->linked_mode) {
+        return *node;
+    }
+    return owner->contiguous[index];
+}
+
+/**
+ * @brief Arrow operator for const iterator.
+ *
+ * @return A const pointer to the current element.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_iterator::pointer AdaptiveList<T>::const_iterator::operator->() const {
+    return &**this;
+}
+
+/**
+ * @brief Prefix increment operator for const iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_iterator& AdaptiveList<T>::const_iterator::operator++() {
+    if (owner->linked_mode) {
+        ++node;
+    }
+    else {
+        ++index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for const iterator.
+ *
+ * Steps back from `cend()` in linked mode the same way as `iterator`.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_iterator& AdaptiveList<T>::const_iterator::operator--() {
+    if (owner->linked_mode) {
+        if (node == owner->linked.cend()) {
+            node = typename List<T>::const_iterator(List<T>::live_backward(owner->linked.tail));
+        }
+        else {
+            --node;
+        }
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_iterator AdaptiveList<T>::const_iterator::operator++(int) {
+    const_iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for const iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_iterator AdaptiveList<T>::const_iterator::operator--(int) {
+    const_iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators reference the same position, false otherwise.
+ */
+template <typename T>
+bool AdaptiveList<T>::const_iterator::operator==(const const_iterator& other) const {
+    return node == other.node && index == other.index;
+}
+
+/**
+ * @brief Inequality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators reference different positions, false otherwise.
+ */
+template <typename T>
+bool AdaptiveList<T>::const_iterator::operator!=(const const_iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructs an empty list in the contiguous representation.
+ */
+template <typename T>
+AdaptiveList<T>::AdaptiveList() : linked_mode(false), structural_ops(0), sequential_ops(0) { }
+
+/**
+ * @brief Constructs a contiguous list holding copies of the given values.
+ *
+ * @param init The values to copy.
+ */
+template <typename T>
+AdaptiveList<T>::AdaptiveList(std::initializer_list<T> init)
+    : contiguous(init), linked_mode(false), structural_ops(0), sequential_ops(0) { }
+
+/**
+ * @brief Accessor to the front element of the list.
+ *
+ * @return A reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename AdaptiveList<T>::reference AdaptiveList<T>::front() {
+    if (linked_mode) {
+        return linked.front();
+    }
+    if (contiguous.empty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return contiguous.front();
+}
+
+/**
+ * @brief Const accessor to the front element of the list.
+ *
+ * @return A const reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_reference AdaptiveList<T>::front() const {
+    if (linked_mode) {
+        return linked.front();
+    }
+    if (contiguous.empty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return contiguous.front();
+}
+
+/**
+ * @brief Accessor to the back element of the list.
+ *
+ * @return A reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename AdaptiveList<T>::reference AdaptiveList<T>::back() {
+    if (linked_mode) {
+        return linked.back();
+    }
+    if (contiguous.empty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return contiguous.back();
+}
+
+/**
+ * @brief Const accessor to the back element of the list.
+ *
+ * @return A const reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_reference AdaptiveList<T>::back() const {
+    if (linked_mode) {
+        return linked.back();
+    }
+    if (contiguous.empty()) {
+        throw std::out_of_range("List is empty");
+    }
+    return contiguous.back();
+}
+
+/**
+ * @brief Unchecked index access; O(1) while contiguous and a walk from the front while linked.
+ *
+ * @param index The position of the element.
+ * @return A reference to the element.
+ */
+template <typename T>
+typename AdaptiveList<T>::reference AdaptiveList<T>::operator[](size_type index) {
+    record_sequential();
+    if (linked_mode) {
+        return *std::next(linked.begin(), static_cast<difference_type>(index));
+    }
+    return contiguous[index];
+}
+
+/**
+ * @brief Unchecked const index access; O(1) while contiguous and a walk from the front while linked.
+ *
+ * Like every const access, this is not counted towards the representation choice.
+ *
+ * @param index The position of the element.
+ * @return A const reference to the element.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_reference AdaptiveList<T>::operator[](size_type index) const {
+    if (linked_mode) {
+        return *std::next(linked.cbegin(), static_cast<difference_type>(index));
+    }
+    return contiguous[index];
+}
+
+/**
+ * @brief Bounds-checked index access.
+ *
+ * @param index The position of the element.
+ * @return A reference to the element.
+ * @throw std::out_of_range if `index` is not less than the size.
+ */
+template <typename T>
+typename AdaptiveList<T>::reference AdaptiveList<T>::at(size_type index) {
+    if (index >= getSize()) {
+        throw std::out_of_range("AdaptiveList index out of range");
+    }
+    return (*this)[index];
+}
+
+/**
+ * @brief Bounds-checked const index access.
+ *
+ * @param index The position of the element.
+ * @return A const reference to the element.
+ * @throw std::out_of_range if `index` is not less than the size.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_reference AdaptiveList<T>::at(size_type index) const {
+    if (index >= getSize()) {
+        throw std::out_of_range("AdaptiveList index out of range");
+    }
+    return (*this)[index];
+}
+
+/**
+ * @brief Adds an element to the back of the list.
+ *
+ * Like every push and pop, this may first convert the representation, which invalidates all
+ * iterators and references.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void AdaptiveList<T>::push_back(const T& value) {
+    maybe_switch();
+    record_sequential();
+    if (linked_mode) {
+        linked.push_back(value);
+    }
+    else {
+        contiguous.push_back(value);
+    }
+}
+
+/**
+ * @brief Adds an r-value element to the back of the list.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void AdaptiveList<T>::push_back(T&& value) {
+    maybe_switch();
+    record_sequential();
+    if (linked_mode) {
+        linked.emplace_back(std::move(value));
+    }
+    else {
+        contiguous.push_back(std::move(value));
+    }
+}
+
+/**
+ * @brief Adds an element to the front of the list; O(n) while contiguous.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void AdaptiveList<T>::push_front(const T& value) {
+    maybe_switch();
+    record_structural();
+    if (linked_mode) {
+        linked.push_front(value);
+    }
+    else {
+        contiguous.insert(contiguous.begin(), value);
+    }
+}
+
+/**
+ * @brief Adds an r-value element to the front of the list; O(n) while contiguous.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void AdaptiveList<T>::push_front(T&& value) {
+    maybe_switch();
+    record_structural();
+    if (linked_mode) {
+        linked.push_front(std::move(value));
+    }
+    else {
+        contiguous.insert(contiguous.begin(), std::move(value));
+    }
+}
+
+/**
+ * @brief Constructs and appends a new element to the end of the list.
+ *
+ * @param args The arguments to construct the new element.
+ * @return A reference to the new element.
+ */
+template <typename T>
+template<typename... Args>
+typename AdaptiveList<T>::reference AdaptiveList<T>::emplace_back(Args&&... args) {
+    maybe_switch();
+    record_sequential();
+    if (linked_mode) {
+        return linked.emplace_back(std::forward<Args>(args)...);
+    }
+    return contiguous.emplace_back(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Removes the last element from the list; does nothing if the list is empty.
+ */
+template <typename T>
+void AdaptiveList<T>::pop_back() {
+    maybe_switch();
+    record_sequential();
+    if (linked_mode) {
+        linked.pop_back();
+    }
+    else if (!contiguous.empty()) {
+        contiguous.pop_back();
+    }
+}
+
+/**
+ * @brief Removes the first element from the list; does nothing if the list is empty. O(n) while contiguous.
+ */
+template <typename T>
+void AdaptiveList<T>::pop_front() {
+    maybe_switch();
+    record_structural();
+    if (linked_mode) {
+        linked.pop_front();
+    }
+    else if (!contiguous.empty()) {
+        contiguous.erase(contiguous.begin());
+    }
+}
+
+/**
+ * @brief Inserts a copy of a value before the given position.
+ *
+ * @param pos The position to insert before.
+ * @param value The value to insert.
+ * @return An iterator to the inserted element.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator AdaptiveList<T>::insert(iterator pos, const T& value) {
+    return insert(pos, T(value));
+}
+
+/**
+ * @brief Inserts an r-value before the given position.
+ *
+ * Inserting at `end()` counts as an append; any other position counts towards switching to the
+ * linked representation. A switch invalidates every other iterator, but the returned one stays
+ * valid.
+ *
+ * @param pos The position to insert before.
+ * @param value The value to insert.
+ * @return An iterator to the inserted element.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator AdaptiveList<T>::insert(iterator pos, T&& value) {
+    if (pos == end()) {
+        record_sequential();
+    }
+    else {
+        record_structural();
+    }
+    if (linked_mode) {
+        return maybe_switch(iterator(this, linked.insert(pos.node, std::move(value)), 0));
+    }
+    contiguous.insert(contiguous.begin() + static_cast<difference_type>(pos.index), std::move(value));
+    return maybe_switch(iterator(this, linked.end(), pos.index));
+}
+
+/**
+ * @brief Removes the element at the given position.
+ *
+ * Like `insert`, this may switch the representation; only the returned iterator stays valid.
+ *
+ * @param pos A valid element position.
+ * @return An iterator to the element that followed the removed one.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator AdaptiveList<T>::erase(iterator pos) {
+    if (linked_mode) {
+        record_structural();
+        return maybe_switch(iterator(this, linked.erase(pos.node), 0));
+    }
+    if (pos.index + 1 == contiguous.size()) {
+        record_sequential();
+    }
+    else {
+        record_structural();
+    }
+    contiguous.erase(contiguous.begin() + static_cast<difference_type>(pos.index));
+    return maybe_switch(iterator(this, linked.end(), pos.index));
+}
+
+/**
+ * @brief Clears the list and returns to the contiguous representation with fresh statistics.
+ */
+template <typename T>
+void AdaptiveList<T>::clear() {
+    linked.clear();
+    contiguous.clear();
+    linked_mode = false;
+    structural_ops = 0;
+    sequential_ops = 0;
+}
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * Scans are counted per element as the iterator advances, not per call.
+ *
+ * @return An iterator to the first element.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator AdaptiveList<T>::begin() {
+    if (linked_mode) {
+        return iterator(this, linked.begin(), 0);
+    }
+    return iterator(this, linked.end(), 0);
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return The end iterator.
+ */
+template <typename T>
+typename AdaptiveList<T>::iterator AdaptiveList<T>::end() {
+    return iterator(this, linked.end(), linked_mode ? 0 : contiguous.size());
+}
+
+/**
+ * @brief Returns a constant iterator to the first element.
+ *
+ * Scans through constant iterators are not counted, so concurrent readers never write to the list.
+ *
+ * @return A constant iterator to the first element.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_iterator AdaptiveList<T>::cbegin() const {
+    if (linked_mode) {
+        return const_iterator(this, linked.cbegin(), 0);
+    }
+    return const_iterator(this, linked.cend(), 0);
+}
+
+/**
+ * @brief Returns a constant iterator past the last element.
+ *
+ * @return The constant end iterator.
+ */
+template <typename T>
+typename AdaptiveList<T>::const_iterator AdaptiveList<T>::cend() const {
+    return const_iterator(this, linked.cend(), linked_mode ? 0 : contiguous.size());
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @return The size of the list.
+ */
+template <typename T>
+typename AdaptiveList<T>::size_type AdaptiveList<T>::getSize() const {
+    return linked_mode ? linked.getSize() : contiguous.size();
+}
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * @return `true` if the list is empty, `false` otherwise.
+ */
+template <typename T>
+bool AdaptiveList<T>::empty() const {
+    return getSize() == 0;
+}
+
+/**
+ * @brief Reports the current representation.
+ *
+ * @return `true` while elements are stored in a vector, `false` while they are in linked nodes.
+ */
+template <typename T>
+bool AdaptiveList<T>::is_contiguous() const {
+    return !linked_mode;
+}
+
+/**
+ * @brief Forces the contiguous representation, for example before a long read-only phase.
+ *
+ * Invalidates all iterators and references if the representation changes.
+ */
+template <typename T>
+void AdaptiveList<T>::make_contiguous() {
+    if (linked_mode) {
+        to_contiguous();
+    }
+    structural_ops = 0;
+    sequential_ops = 0;
+}
+
+/**
+ * @brief Forces the linked representation, for example before a burst of middle edits.
+ *
+ * Invalidates all iterators and references if the representation changes.
+ */
+template <typename T>
+void AdaptiveList<T>::make_linked() {
+    if (!linked_mode) {
+        to_linked();
+    }
+    structural_ops = 0;
+    sequential_ops = 0;
+}
@@ -0,0 +1,119 @@
+#ifndef BOUNDED_LIST_H
+#define BOUNDED_LIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include "nodePoolHeader.hpp"
+
+template <typename T>
+class BoundedList {
+private:
+    struct Node {
+        alignas(T) unsigned char storage[sizeof(T)];
+        Node* next;
+        Node* prev;
+        T* value();
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+    };
+
+    Node* head;
+    Node* tail;
+    Node* spare;
+    std::size_t size;
+    std::size_t cap;
+
+    Node* acquire();
+    void link_back(Node*);
+    void unlink_front();
+    void rotate_front();
+    std::optional<T> replace_front(T&);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator(Node*, const BoundedList*);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator& operator--();
+        iterator operator++(int);
+        iterator operator--(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+    private:
+        Node* node_ptr;
+        const BoundedList* owner;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = const T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator(Node*, const BoundedList*);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int);
+        const_iterator operator--(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+    private:
+        Node* node_ptr;
+        const BoundedList* owner;
+    };
+
+    explicit BoundedList(size_type);
+    BoundedList(const BoundedList&) = delete;
+    BoundedList& operator=(const BoundedList&) = delete;
+    ~BoundedList();
+
+    std::optional<T> push_back(const T&);
+    std::optional<T> push_back(T&&);
+
+    template<typename... Args>
+    std::optional<T> emplace_back(Args&&...);
+
+    void pop_front();
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+    void clear();
+    void shrink_spare();
+
+    iterator begin();
+    iterator end();
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    size_type getSize() const;
+    size_type capacity() const;
+    bool empty() const;
+    bool full() const;
+};
+
+#include "boundedListImplementation.tpp"
+
+#endif
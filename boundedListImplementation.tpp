@@ -0,0 +1,564 @@
+#include "boundedListHeader.hpp"
+
+/**
+ * @brief Returns the element stored in the node's raw storage.
+ *
+ * @return A pointer to the node's element; only valid while the node is linked.
+ */
+template <typename T>
+T* BoundedList<T>::Node::value() {
+    return std::launder(reinterpret_cast<T*>(storage));
+}
+
+/**
+ * @brief Allocates a node from the shared slab pool.
+ *
+ * @param bytes The size of the node, always `sizeof(Node)`.
+ * @return Storage for one node.
+ */
+template <typename T>
+void* BoundedList<T>::Node::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Node), alignof(Node)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a node's storage to the shared slab pool.
+ *
+ * @param ptr The node storage to release.
+ */
+template <typename T>
+void BoundedList<T>::Node::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Node), alignof(Node)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Takes a node from the spare list, allocating one only if the spare list is empty.
+ *
+ * @return An unlinked node with no element constructed in it.
+ */
+template <typename T>
+typename BoundedList<T>::Node* BoundedList<T>::acquire() {
+    if (spare) {
+        Node* node = spare;
+        spare = spare->next;
+        return node;
+    }
+    return new Node;
+}
+
+/**
+ * @brief Links a node holding a constructed element at the back of the list.
+ *
+ * @param node The node to link.
+ */
+template <typename T>
+void BoundedList<T>::link_back(Node* node) {
+    node->next = nullptr;
+    node->prev = tail;
+    if (tail) {
+        tail->next = node;
+    }
+    else {
+        head = node;
+    }
+    tail = node;
+}
+
+/**
+ * @brief Unlinks the front node and parks it on the spare list.
+ *
+ * The element must already have been destroyed or moved into another node.
+ */
+template <typename T>
+void BoundedList<T>::unlink_front() {
+    Node* node = head;
+    head = head->next;
+    if (head) {
+        head->prev = nullptr;
+    }
+    else {
+        tail = nullptr;
+    }
+    node->next = spare;
+    spare = node;
+}
+
+/**
+ * @brief Moves the front node, with its element, to the back of the list.
+ */
+template <typename T>
+void BoundedList<T>::rotate_front() {
+    if (head == tail) {
+        return;
+    }
+    Node* node = head;
+    head = node->next;
+    head->prev = nullptr;
+    link_back(node);
+}
+
+/**
+ * @brief Swaps an already constructed value into the front node and rotates it to the back.
+ *
+ * Callers build `incoming` before touching the list, so values that alias the front element
+ * are read intact and a throwing constructor leaves the list unchanged.
+ *
+ * @param incoming The new element; on return it holds nothing the caller needs.
+ * @return The evicted element.
+ */
+template <typename T>
+std::optional<T> BoundedList<T>::replace_front(T& incoming) {
+    using std::swap;
+    swap(*head->value(), incoming);
+    rotate_front();
+    return std::optional<T>(std::move(incoming));
+}
+
+/**
+ * @brief Constructor for an iterator, initializing it with a node pointer.
+ *
+ * @param ptr The node the iterator will reference, or nullptr for `end()`.
+ * @param list The list the node belongs to, used to step back from `end()`.
+ */
+template <typename T>
+BoundedList<T>::iterator::iterator(Node* ptr, const BoundedList* list) : node_ptr(ptr), owner(list) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A reference to the element in the current node.
+ */
+template <typename T>
+typename BoundedList<T>::iterator::reference BoundedList<T>::iterator::operator*() const {
+    return *node_ptr->value();
+}
+
+/**
+ * @brief Arrow operator for iterator.
+ *
+ * @return A pointer to the element in the current node.
+ */
+template <typename T>
+typename BoundedList<T>::iterator::pointer BoundedList<T>::iterator::operator->() const {
+    return node_ptr->value();
+}
+
+/**
+ * @brief Prefix increment operator for iterator, moving it to the next (newer) element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename BoundedList<T>::iterator& BoundedList<T>::iterator::operator++() {
+    node_ptr = node_ptr->next;
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for iterator, moving it to the previous (older) element.
+ *
+ * Decrementing `end()` yields the newest element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename BoundedList<T>::iterator& BoundedList<T>::iterator::operator--() {
+    node_ptr = node_ptr ? node_ptr->prev : owner->tail;
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename BoundedList<T>::iterator BoundedList<T>::iterator::operator++(int) {
+    iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename BoundedList<T>::iterator BoundedList<T>::iterator::operator--(int) {
+    iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators point to the same node, false otherwise.
+ */
+template <typename T>
+bool BoundedList<T>::iterator::operator==(const iterator& other) const {
+    return node_ptr == other.node_ptr;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators point to different nodes, false otherwise.
+ */
+template <typename T>
+bool BoundedList<T>::iterator::operator!=(const iterator& other) const {
+    return node_ptr != other.node_ptr;
+}
+
+/**
+ * @brief Constructor for a const iterator, initializing it with a node pointer.
+ *
+ * @param ptr The node the iterator will reference, or nullptr for `cend()`.
+ * @param list The list the node belongs to, used to step back from `cend()`.
+ */
+template <typename T>
+BoundedList<T>::const_iterator::const_iterator(Node* ptr, const BoundedList* list) : node_ptr(ptr), owner(list) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return A const reference to the element in the current node.
+ */
+template <typename T>
+typename BoundedList<T>::const_iterator::reference BoundedList<T>::const_iterator::operator*() const {
+    return *node_ptr->value();
+}
+
+/**
+ * @brief Arrow operator for const iterator.
+ *
+ * @return A const pointer to the element in the current node.
+ */
+template <typename T>
+typename BoundedList<T>::const_iterator::pointer BoundedList<T>::const_iterator::operator->() const {
+    return node_ptr->value();
+}
+
+/**
+ * @brief Prefix increment operator for const iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename BoundedList<T>::const_iterator& BoundedList<T>::const_iterator::operator++() {
+    node_ptr = node_ptr->next;
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for const iterator; decrementing `cend()` yields the newest element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename BoundedList<T>::const_iterator& BoundedList<T>::const_iterator::operator--() {
+    node_ptr = node_ptr ? node_ptr->prev : owner->tail;
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename BoundedList<T>::const_iterator BoundedList<T>::const_iterator::operator++(int) {
+    const_iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for const iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename BoundedList<T>::const_iterator BoundedList<T>::const_iterator::operator--(int) {
+    const_iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators point to the same node, false otherwise.
+ */
+template <typename T>
+bool BoundedList<T>::const_iterator::operator==(const const_iterator& other) const {
+    return node_ptr == other.node_ptr;
+}
+
+/**
+ * @brief Inequality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators point to different nodes, false otherwise.
+ */
+template <typename T>
+bool BoundedList<T>::const_iterator::operator!=(const const_iterator& other) const {
+    return node_ptr != other.node_ptr;
+}
+
+/**
+ * @brief Constructs an empty list that holds at most `capacity` elements.
+ *
+ * @param capacity The maximum number of elements.
+ * @throw std::invalid_argument if `capacity` is zero.
+ */
+template <typename T>
+BoundedList<T>::BoundedList(size_type capacity) : head(nullptr), tail(nullptr), spare(nullptr), size(0), cap(capacity) {
+    if (!cap) {
+        throw std::invalid_argument("BoundedList capacity must be positive");
+    }
+}
+
+/**
+ * @brief Destroys the elements and frees every node, including the spare ones.
+ */
+template <typename T>
+BoundedList<T>::~BoundedList() {
+    clear();
+    shrink_spare();
+}
+
+/**
+ * @brief Appends a copy of a value, evicting the oldest element if the list is full.
+ *
+ * When full, the front node is reused in place: a copy of `value` is swapped into it and the
+ * node is relinked at the back, with no allocation or deallocation. The copy is made first, so
+ * `value` may refer to the element being evicted.
+ *
+ * @param value The value to append.
+ * @return The evicted element, or `std::nullopt` if there was room.
+ */
+template <typename T>
+std::optional<T> BoundedList<T>::push_back(const T& value) {
+    return emplace_back(value);
+}
+
+/**
+ * @brief Appends an r-value, evicting the oldest element if the list is full.
+ *
+ * @param value The value to append.
+ * @return The evicted element, or `std::nullopt` if there was room.
+ */
+template <typename T>
+std::optional<T> BoundedList<T>::push_back(T&& value) {
+    return emplace_back(std::move(value));
+}
+
+/**
+ * @brief Constructs an element at the back, evicting the oldest element if the list is full.
+ *
+ * When full, the new element is constructed before the front node is touched, so `args` may
+ * refer to the element being evicted. Either way a throwing constructor leaves the list
+ * unchanged; a node taken for the new element goes back to the spare list.
+ *
+ * @param args The arguments to construct the new element from.
+ * @return The evicted element, or `std::nullopt` if there was room.
+ */
+template <typename T>
+template<typename... Args>
+std::optional<T> BoundedList<T>::emplace_back(Args&&... args) {
+    if (size < cap) {
+        Node* node = acquire();
+        try {
+            ::new (static_cast<void*>(node->storage)) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            node->next = spare;
+            spare = node;
+            throw;
+        }
+        link_back(node);
+        ++size;
+        return std::nullopt;
+    }
+    T incoming(std::forward<Args>(args)...);
+    return replace_front(incoming);
+}
+
+/**
+ * @brief Removes the oldest element in O(1).
+ *
+ * The node is kept on a spare list and reused by the next append.
+ */
+template <typename T>
+void BoundedList<T>::pop_front() {
+    if (!head) {
+        return;
+    }
+    head->value()->~T();
+    unlink_front();
+    --size;
+}
+
+/**
+ * @brief Accessor to the oldest element.
+ *
+ * @return A reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename BoundedList<T>::reference BoundedList<T>::front() {
+    if (!head) {
+        throw std::out_of_range("BoundedList is empty");
+    }
+    return *head->value();
+}
+
+/**
+ * @brief Const accessor to the oldest element.
+ *
+ * @return A const reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename BoundedList<T>::const_reference BoundedList<T>::front() const {
+    if (!head) {
+        throw std::out_of_range("BoundedList is empty");
+    }
+    return *head->value();
+}
+
+/**
+ * @brief Accessor to the newest element.
+ *
+ * @return A reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename BoundedList<T>::reference BoundedList<T>::back() {
+    if (!tail) {
+        throw std::out_of_range("BoundedList is empty");
+    }
+    return *tail->value();
+}
+
+/**
+ * @brief Const accessor to the newest element.
+ *
+ * @return A const reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename BoundedList<T>::const_reference BoundedList<T>::back() const {
+    if (!tail) {
+        throw std::out_of_range("BoundedList is empty");
+    }
+    return *tail->value();
+}
+
+/**
+ * @brief Destroys every element, keeping the nodes on the spare list for reuse.
+ */
+template <typename T>
+void BoundedList<T>::clear() {
+    while (head) {
+        pop_front();
+    }
+}
+
+/**
+ * @brief Frees the spare nodes left behind by `pop_front` and `clear`.
+ */
+template <typename T>
+void BoundedList<T>::shrink_spare() {
+    while (spare) {
+        Node* node = spare;
+        spare = spare->next;
+        delete node;
+    }
+}
+
+/**
+ * @brief Returns an iterator to the oldest element.
+ *
+ * @return An iterator to the first element.
+ */
+template <typename T>
+typename BoundedList<T>::iterator BoundedList<T>::begin() {
+    return iterator(head, this);
+}
+
+/**
+ * @brief Returns an iterator past the newest element.
+ *
+ * @return An iterator past the last element.
+ */
+template <typename T>
+typename BoundedList<T>::iterator BoundedList<T>::end() {
+    return iterator(nullptr, this);
+}
+
+/**
+ * @brief Returns a constant iterator to the oldest element.
+ *
+ * @return A constant iterator to the first element.
+ */
+template <typename T>
+typename BoundedList<T>::const_iterator BoundedList<T>::cbegin() const {
+    return const_iterator(head, this);
+}
+
+/**
+ * @brief Returns a constant iterator past the newest element.
+ *
+ * @return A constant iterator past the last element.
+ */
+template <typename T>
+typename BoundedList<T>::const_iterator BoundedList<T>::cend() const {
+    return const_iterator(nullptr, this);
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @return The size of the list.
+ */
+template <typename T>
+typename BoundedList<T>::size_type BoundedList<T>::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Returns the maximum number of elements the list holds before evicting.
+ *
+ * @return The capacity of the list.
+ */
+template <typename T>
+typename BoundedList<T>::size_type BoundedList<T>::capacity() const {
+    return cap;
+}
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * @return true if the list holds no elements.
+ */
+template <typename T>
+bool BoundedList<T>::empty() const {
+    return size == 0;
+}
+
+/**
+ * @brief Checks whether the next append will evict the oldest element.
+ *
+ * @return true if the list holds `capacity()` elements.
+ */
+template <typename T>
+bool BoundedList<T>::full() const {
+    return size == cap;
+}
@@ -0,0 +1,117 @@
+#ifndef CHAINED_HASH_MAP_H
+#define CHAINED_HASH_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include "interleavedTraversalHeader.hpp"
+#include "nodePoolHeader.hpp"
+
+#ifndef CHAINED_HASH_MAP_INITIAL_BUCKETS
+#define CHAINED_HASH_MAP_INITIAL_BUCKETS 16
+#endif
+
+#ifndef CHAINED_HASH_MAP_MAX_LOAD
+#define CHAINED_HASH_MAP_MAX_LOAD 1
+#endif
+
+#ifndef CHAINED_HASH_MAP_REHASH_STEP
+#define CHAINED_HASH_MAP_REHASH_STEP 4
+#endif
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class ChainedHashMap {
+    static_assert((CHAINED_HASH_MAP_INITIAL_BUCKETS & (CHAINED_HASH_MAP_INITIAL_BUCKETS - 1)) == 0 && CHAINED_HASH_MAP_INITIAL_BUCKETS > 0,
+                  "CHAINED_HASH_MAP_INITIAL_BUCKETS must be a power of two");
+    static_assert(CHAINED_HASH_MAP_REHASH_STEP > 0, "CHAINED_HASH_MAP_REHASH_STEP must be positive");
+
+private:
+    struct Node {
+        Node* next;
+        std::size_t hash;
+        K key;
+        V value;
+        template<typename Key, typename... Args>
+        Node(std::size_t, Key&&, Args&&...);
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+    };
+
+    struct BucketRelease {
+        void operator()(Node**) const noexcept;
+    };
+
+    using Buckets = std::unique_ptr<Node*[], BucketRelease>;
+
+    Buckets table;
+    std::size_t table_size;
+    Buckets old_table;
+    std::size_t old_size;
+    std::size_t migrated;
+    std::size_t size;
+    [[no_unique_address]] Hash hasher;
+    [[no_unique_address]] KeyEqual equal;
+
+    static Buckets allocate_buckets(std::size_t);
+    static void free_chains(Node**, std::size_t) noexcept;
+
+    Node** bucket_of(std::size_t) const;
+    Node* find_node(std::size_t, const K&) const;
+    void migrate(std::size_t);
+    void grow();
+    void copy_chain(const Node*);
+
+    template<typename Key, typename... Args>
+    std::pair<V*, bool> try_emplace_hashed(std::size_t, Key&&, Args&&...);
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    ChainedHashMap();
+    ChainedHashMap(const ChainedHashMap&);
+    ChainedHashMap(ChainedHashMap&&) noexcept;
+    ChainedHashMap& operator=(const ChainedHashMap&);
+    ChainedHashMap& operator=(ChainedHashMap&&) noexcept;
+    ~ChainedHashMap();
+
+    bool insert(const K&, const V&);
+    bool insert(K&&, V&&);
+
+    template<typename Key, typename... Args>
+    std::pair<V*, bool> try_emplace(Key&&, Args&&...);
+
+    template<typename Value>
+    bool insert_or_assign(const K&, Value&&);
+
+    V& operator[](const K&);
+    bool erase(const K&);
+    V* find(const K&);
+    const V* find(const K&) const;
+    bool contains(const K&) const;
+    void find_batch(std::span<const K>, std::span<V*>);
+    void clear() noexcept;
+    void swap(ChainedHashMap&) noexcept;
+
+    template<typename F>
+    void for_each(F&&);
+
+    template<typename F>
+    void for_each(F&&) const;
+
+    size_type bucket_count() const;
+    bool rehashing() const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "chainedHashMapImplementation.tpp"
+
+#endif
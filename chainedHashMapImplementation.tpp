@@ -0,0 +1,589 @@
+#include "chainedHashMapHeader.hpp"
+
+/**
+ * @brief Constructs an unlinked node.
+ *
+ * @param hash The key's hash, kept so that rehashing never calls the hasher again.
+ * @param key The key.
+ * @param args Arguments forwarded to the value's constructor.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename Key, typename... Args>
+ChainedHashMap<K, V, Hash, KeyEqual>::Node::Node(std::size_t hash, Key&& key, Args&&... args)
+    : next(nullptr), hash(hash), key(std::forward<Key>(key)), value(std::forward<Args>(args)...) { }
+
+/**
+ * @brief Allocates a node from the shared slab pool.
+ *
+ * @param bytes Unused; nodes have a fixed size.
+ * @return Storage for one node.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void* ChainedHashMap<K, V, Hash, KeyEqual>::Node::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Node), alignof(Node)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a node's storage to the shared slab pool.
+ *
+ * @param ptr The node storage.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::Node::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Node), alignof(Node)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Frees a bucket array obtained from `allocate_buckets`.
+ *
+ * @param buckets The bucket array.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::BucketRelease::operator()(Node** buckets) const noexcept {
+    std::free(buckets);
+}
+
+/**
+ * @brief Allocates an array of empty bucket heads.
+ *
+ * The array comes from `calloc`, so a large table is backed by zero pages that the system maps
+ * on first touch instead of being cleared up front, and growing stays cheap at any size.
+ *
+ * @param count The number of buckets.
+ * @return The bucket array, every head null.
+ * @throw std::bad_alloc if the array cannot be allocated.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename ChainedHashMap<K, V, Hash, KeyEqual>::Buckets ChainedHashMap<K, V, Hash, KeyEqual>::allocate_buckets(std::size_t count) {
+    void* memory = std::calloc(count, sizeof(Node*));
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return Buckets(static_cast<Node**>(memory));
+}
+
+/**
+ * @brief Destroys every node chained from a bucket array.
+ *
+ * @param buckets The bucket array, or nullptr.
+ * @param count The number of buckets.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::free_chains(Node** buckets, std::size_t count) noexcept {
+    if (!buckets) {
+        return;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        for (Node* node = buckets[i]; node;) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+        buckets[i] = nullptr;
+    }
+}
+
+/**
+ * @brief Returns the bucket head a hash currently lives in.
+ *
+ * While a rehash is in progress, buckets of the old table below the migration cursor have been
+ * emptied into the new table; the rest still hold their nodes.
+ *
+ * @param hash The hash; the map must have a table.
+ * @return The bucket head.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename ChainedHashMap<K, V, Hash, KeyEqual>::Node** ChainedHashMap<K, V, Hash, KeyEqual>::bucket_of(std::size_t hash) const {
+    if (old_table && (hash & (old_size - 1)) >= migrated) {
+        return &old_table[hash & (old_size - 1)];
+    }
+    return &table[hash & (table_size - 1)];
+}
+
+/**
+ * @brief Finds the node for a key.
+ *
+ * @param hash The key's hash.
+ * @param key The key.
+ * @return The node, or nullptr if the key is not present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename ChainedHashMap<K, V, Hash, KeyEqual>::Node* ChainedHashMap<K, V, Hash, KeyEqual>::find_node(std::size_t hash, const K& key) const {
+    if (!table) {
+        return nullptr;
+    }
+    for (Node* node = *bucket_of(hash); node; node = node->next) {
+        if (node->hash == hash && equal(node->key, key)) {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Moves up to `count` buckets of the old table into the new one.
+ *
+ * Nodes are spliced onto their new chains by relinking, using their stored hash; nothing is
+ * allocated, copied or rehashed. The old table is freed once its last bucket has moved.
+ *
+ * @param count The number of old buckets to move.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::migrate(std::size_t count) {
+    if (!old_table) {
+        return;
+    }
+    for (; count > 0 && migrated < old_size; --count, ++migrated) {
+        Node* node = old_table[migrated];
+        old_table[migrated] = nullptr;
+        while (node) {
+            Node* next = node->next;
+            Node*& head = table[node->hash & (table_size - 1)];
+            node->next = head;
+            head = node;
+            node = next;
+        }
+    }
+    if (migrated == old_size) {
+        old_table.reset();
+        old_size = 0;
+        migrated = 0;
+    }
+}
+
+/**
+ * @brief Starts an incremental rehash into a table with twice as many buckets.
+ *
+ * Only the new bucket array is allocated here. The nodes move a few buckets at a time during later
+ * inserts and erases. If the previous rehash has not finished, its remaining buckets are moved
+ * first, which the growth rate makes rare: a table must double its size before it grows again,
+ * and every insert meanwhile moves `CHAINED_HASH_MAP_REHASH_STEP` buckets.
+ *
+ * @throw std::bad_alloc if the new bucket array cannot be allocated; the map is unchanged.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::grow() {
+    Buckets fresh = allocate_buckets(table_size * 2);
+    migrate(old_size);
+    old_table = std::move(table);
+    old_size = table_size;
+    migrated = 0;
+    table = std::move(fresh);
+    table_size *= 2;
+}
+
+/**
+ * @brief Links a copy of every node in another map's chain into this map's table.
+ *
+ * The caller guarantees that the keys are not present yet and that the table has room for them.
+ *
+ * @param node The first node of the chain to copy, or nullptr.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::copy_chain(const Node* node) {
+    for (; node; node = node->next) {
+        Node* copy = new Node(node->hash, node->key, node->value);
+        Node*& head = table[node->hash & (table_size - 1)];
+        copy->next = head;
+        head = copy;
+        ++size;
+    }
+}
+
+/**
+ * @brief Inserts a node for a key with a precomputed hash unless the key is present.
+ *
+ * Moves `CHAINED_HASH_MAP_REHASH_STEP` buckets of a rehash in progress first, and starts a
+ * rehash before linking a node that would push the load factor past `CHAINED_HASH_MAP_MAX_LOAD`.
+ *
+ * @param hash The key's hash.
+ * @param key The key.
+ * @param args Arguments forwarded to the value's constructor if the key is inserted.
+ * @return The value for the key, and whether it was inserted.
+ * @throw std::bad_alloc if a node or bucket array cannot be allocated; the map is unchanged.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename Key, typename... Args>
+std::pair<V*, bool> ChainedHashMap<K, V, Hash, KeyEqual>::try_emplace_hashed(std::size_t hash, Key&& key, Args&&... args) {
+    if (!table) {
+        table = allocate_buckets(CHAINED_HASH_MAP_INITIAL_BUCKETS);
+        table_size = CHAINED_HASH_MAP_INITIAL_BUCKETS;
+    }
+    migrate(CHAINED_HASH_MAP_REHASH_STEP);
+    if (Node* node = find_node(hash, key)) {
+        return {&node->value, false};
+    }
+    if (size + 1 > table_size * CHAINED_HASH_MAP_MAX_LOAD) {
+        grow();
+    }
+    Node* node = new Node(hash, std::forward<Key>(key), std::forward<Args>(args)...);
+    Node** head = bucket_of(hash);
+    node->next = *head;
+    *head = node;
+    ++size;
+    return {&node->value, true};
+}
+
+/**
+ * @brief Constructs an empty map. No bucket array is allocated until the first insert.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+ChainedHashMap<K, V, Hash, KeyEqual>::ChainedHashMap() : table_size(0), old_size(0), migrated(0), size(0) { }
+
+/**
+ * @brief Constructs a copy of another map.
+ *
+ * The copy gets a table as large as the source's current one, which already holds every pair
+ * within the load limit, so the copy has no rehash in progress. Nodes are linked by their stored
+ * hash without calling the hasher or comparing keys.
+ *
+ * @param other The map to copy.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+ChainedHashMap<K, V, Hash, KeyEqual>::ChainedHashMap(const ChainedHashMap& other)
+    : table_size(0), old_size(0), migrated(0), size(0), hasher(other.hasher), equal(other.equal) {
+    if (!other.table) {
+        return;
+    }
+    table = allocate_buckets(other.table_size);
+    table_size = other.table_size;
+    try {
+        for (std::size_t i = other.migrated; i < other.old_size; ++i) {
+            copy_chain(other.old_table[i]);
+        }
+        for (std::size_t i = 0; i < other.table_size; ++i) {
+            copy_chain(other.table[i]);
+        }
+    }
+    catch (...) {
+        clear();
+        throw;
+    }
+}
+
+/**
+ * @brief Constructs a map by taking over another map's buckets and nodes, including a rehash in progress.
+ *
+ * @param other The map to move from; it is left empty.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+ChainedHashMap<K, V, Hash, KeyEqual>::ChainedHashMap(ChainedHashMap&& other) noexcept
+    : table(std::move(other.table)), table_size(std::exchange(other.table_size, 0)),
+      old_table(std::move(other.old_table)), old_size(std::exchange(other.old_size, 0)),
+      migrated(std::exchange(other.migrated, 0)), size(std::exchange(other.size, 0)),
+      hasher(other.hasher), equal(other.equal) { }
+
+/**
+ * @brief Replaces the contents with a copy of another map.
+ *
+ * @param other The map to copy.
+ * @return This map.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+ChainedHashMap<K, V, Hash, KeyEqual>& ChainedHashMap<K, V, Hash, KeyEqual>::operator=(const ChainedHashMap& other) {
+    if (this != &other) {
+        ChainedHashMap copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+/**
+ * @brief Replaces the contents by taking over another map's buckets and nodes.
+ *
+ * @param other The map to move from; it is left empty.
+ * @return This map.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+ChainedHashMap<K, V, Hash, KeyEqual>& ChainedHashMap<K, V, Hash, KeyEqual>::operator=(ChainedHashMap&& other) noexcept {
+    if (this != &other) {
+        clear();
+        swap(other);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys every node and frees the bucket arrays.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+ChainedHashMap<K, V, Hash, KeyEqual>::~ChainedHashMap() {
+    clear();
+}
+
+/**
+ * @brief Inserts a copy of a key and value if the key is not present.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the pair was inserted, false if the key was already present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool ChainedHashMap<K, V, Hash, KeyEqual>::insert(const K& key, const V& value) {
+    return try_emplace(key, value).second;
+}
+
+/**
+ * @brief Moves a key and value into the map if the key is not present.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the pair was inserted, false if the key was already present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool ChainedHashMap<K, V, Hash, KeyEqual>::insert(K&& key, V&& value) {
+    return try_emplace(std::move(key), std::move(value)).second;
+}
+
+/**
+ * @brief Constructs a value in place for a key that is not present.
+ *
+ * Neither the key nor the arguments are consumed if the key is already present.
+ *
+ * @param key The key.
+ * @param args Arguments forwarded to the value's constructor.
+ * @return A pointer to the value for the key, and whether it was inserted.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename Key, typename... Args>
+std::pair<V*, bool> ChainedHashMap<K, V, Hash, KeyEqual>::try_emplace(Key&& key, Args&&... args) {
+    std::size_t hash = hasher(key);
+    return try_emplace_hashed(hash, std::forward<Key>(key), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Inserts a key with a value, or assigns the value if the key is present.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the key was inserted, false if an existing value was assigned.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename Value>
+bool ChainedHashMap<K, V, Hash, KeyEqual>::insert_or_assign(const K& key, Value&& value) {
+    auto [slot, inserted] = try_emplace(key, std::forward<Value>(value));
+    if (!inserted) {
+        *slot = std::forward<Value>(value);
+    }
+    return inserted;
+}
+
+/**
+ * @brief Returns the value for a key, inserting a value-initialized one if the key is not present.
+ *
+ * @param key The key.
+ * @return The value.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+V& ChainedHashMap<K, V, Hash, KeyEqual>::operator[](const K& key) {
+    return *try_emplace(key).first;
+}
+
+/**
+ * @brief Removes a key.
+ *
+ * Also moves `CHAINED_HASH_MAP_REHASH_STEP` buckets of a rehash in progress.
+ *
+ * @param key The key to remove.
+ * @return True if the key was removed, false if it was not present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool ChainedHashMap<K, V, Hash, KeyEqual>::erase(const K& key) {
+    if (!table) {
+        return false;
+    }
+    migrate(CHAINED_HASH_MAP_REHASH_STEP);
+    std::size_t hash = hasher(key);
+    for (Node** link = bucket_of(hash); *link; link = &(*link)->next) {
+        Node* node = *link;
+        if (node->hash == hash && equal(node->key, key)) {
+            *link = node->next;
+            delete node;
+            --size;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Looks up a key.
+ *
+ * @param key The key to look for.
+ * @return A pointer to the value, or nullptr if the key is not present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+V* ChainedHashMap<K, V, Hash, KeyEqual>::find(const K& key) {
+    Node* node = find_node(hasher(key), key);
+    return node ? &node->value : nullptr;
+}
+
+/**
+ * @brief Looks up a key.
+ *
+ * @param key The key to look for.
+ * @return A pointer to the value, or nullptr if the key is not present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+const V* ChainedHashMap<K, V, Hash, KeyEqual>::find(const K& key) const {
+    const Node* node = find_node(hasher(key), key);
+    return node ? &node->value : nullptr;
+}
+
+/**
+ * @brief Checks whether a key is present.
+ *
+ * @param key The key to look for.
+ * @return True if the key is present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool ChainedHashMap<K, V, Hash, KeyEqual>::contains(const K& key) const {
+    return find_node(hasher(key), key) != nullptr;
+}
+
+/**
+ * @brief Looks up many keys at once, interleaving the bucket and chain walks.
+ *
+ * All keys are hashed first. `InterleavedTraversal` then keeps up to `INTERLEAVED_TRAVERSAL_WIDTH`
+ * lookups in flight, prefetching each bucket head and chain node before it is read, so the cache
+ * misses of a large table overlap instead of being paid one after another.
+ *
+ * @param keys The keys to look up.
+ * @param results Receives, for each key, a pointer to its value or nullptr.
+ * @throw std::invalid_argument if `keys` and `results` differ in length.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::find_batch(std::span<const K> keys, std::span<V*> results) {
+    if (keys.size() != results.size()) {
+        throw std::invalid_argument("find_batch: keys and results must have the same length");
+    }
+    if (!table) {
+        std::fill(results.begin(), results.end(), nullptr);
+        return;
+    }
+    std::unique_ptr<std::size_t[]> hashes(new std::size_t[keys.size()]);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        hashes[i] = hasher(keys[i]);
+    }
+    InterleavedTraversal<>::run(
+        keys.size(),
+        [&](std::size_t i) { return static_cast<const void*>(bucket_of(hashes[i])); },
+        [&](std::size_t i) { return *bucket_of(hashes[i]); },
+        [](Node* node) { return node->next; },
+        [&](std::size_t i, const Node& node) { return node.hash == hashes[i] && equal(node.key, keys[i]); },
+        [&](std::size_t i, Node* node) { results[i] = node ? &node->value : nullptr; });
+}
+
+/**
+ * @brief Removes every pair and frees both bucket arrays.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::clear() noexcept {
+    free_chains(table.get(), table_size);
+    free_chains(old_table.get(), old_size);
+    table.reset();
+    old_table.reset();
+    table_size = 0;
+    old_size = 0;
+    migrated = 0;
+    size = 0;
+}
+
+/**
+ * @brief Exchanges the contents of two maps in constant time.
+ *
+ * @param other The map to swap with.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ChainedHashMap<K, V, Hash, KeyEqual>::swap(ChainedHashMap& other) noexcept {
+    using std::swap;
+    swap(table, other.table);
+    swap(table_size, other.table_size);
+    swap(old_table, other.old_table);
+    swap(old_size, other.old_size);
+    swap(migrated, other.migrated);
+    swap(size, other.size);
+    swap(hasher, other.hasher);
+    swap(equal, other.equal);
+}
+
+/**
+ * @brief Calls a function on every pair, in no particular order.
+ *
+ * @param fn Callable as `fn(const K&, V&)`; it must not insert or erase.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename F>
+void ChainedHashMap<K, V, Hash, KeyEqual>::for_each(F&& fn) {
+    for (std::size_t i = migrated; i < old_size; ++i) {
+        for (Node* node = old_table[i]; node; node = node->next) {
+            fn(static_cast<const K&>(node->key), node->value);
+        }
+    }
+    for (std::size_t i = 0; i < table_size; ++i) {
+        for (Node* node = table[i]; node; node = node->next) {
+            fn(static_cast<const K&>(node->key), node->value);
+        }
+    }
+}
+
+/**
+ * @brief Calls a function on every pair, in no particular order.
+ *
+ * @param fn Callable as `fn(const K&, const V&)`.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename F>
+void ChainedHashMap<K, V, Hash, KeyEqual>::for_each(F&& fn) const {
+    for (std::size_t i = migrated; i < old_size; ++i) {
+        for (const Node* node = old_table[i]; node; node = node->next) {
+            fn(node->key, node->value);
+        }
+    }
+    for (std::size_t i = 0; i < table_size; ++i) {
+        for (const Node* node = table[i]; node; node = node->next) {
+            fn(node->key, node->value);
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of buckets in the current table.
+ *
+ * @return The bucket count; zero before the first insert.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename ChainedHashMap<K, V, Hash, KeyEqual>::size_type ChainedHashMap<K, V, Hash, KeyEqual>::bucket_count() const {
+    return table_size;
+}
+
+/**
+ * @brief Checks whether a rehash is in progress, with nodes still left in the old table.
+ *
+ * @return True while rehashing.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool ChainedHashMap<K, V, Hash, KeyEqual>::rehashing() const {
+    return old_table != nullptr;
+}
+
+/**
+ * @brief Returns the number of pairs in the map.
+ *
+ * @return The number of pairs.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename ChainedHashMap<K, V, Hash, KeyEqual>::size_type ChainedHashMap<K, V, Hash, KeyEqual>::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Checks whether the map is empty.
+ *
+ * @return True if the map holds no pairs.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool ChainedHashMap<K, V, Hash, KeyEqual>::empty() const {
+    return size == 0;
+}
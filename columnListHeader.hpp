@@ -0,0 +1,299 @@
+#ifndef COLUMN_LIST_H
+#define COLUMN_LIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "listKernelsHeader.hpp"
+#include "nodePoolHeader.hpp"
+
+#ifndef COLUMN_LIST_CHUNK_SIZE
+#define COLUMN_LIST_CHUNK_SIZE 64
+#endif
+
+#define COLUMN_LIST_MAX_FIELDS 12
+
+template <typename T>
+struct AggregateFields {
+private:
+    struct AnyField {
+        template<typename U>
+        operator U() const;
+    };
+
+    template<std::size_t... I>
+    static constexpr bool initializable_with(std::index_sequence<I...>) {
+        return requires { T{(void(I), AnyField{})...}; };
+    }
+
+    template<std::size_t N>
+    static constexpr std::size_t count_from() {
+        if constexpr (N < COLUMN_LIST_MAX_FIELDS && initializable_with(std::make_index_sequence<N + 1>{})) {
+            return count_from<N + 1>();
+        }
+        else {
+            return N;
+        }
+    }
+
+public:
+    static constexpr std::size_t count = count_from<0>();
+
+    template<typename U>
+    static auto tie(U& value) {
+        if constexpr (count == 1) {
+            auto& [f0] = value;
+            return std::tie(f0);
+        }
+        else if constexpr (count == 2) {
+            auto& [f0, f1] = value;
+            return std::tie(f0, f1);
+        }
+        else if constexpr (count == 3) {
+            auto& [f0, f1, f2] = value;
+            return std::tie(f0, f1, f2);
+        }
+        else if constexpr (count == 4) {
+            auto& [f0, f1, f2, f3] = value;
+            return std::tie(f0, f1, f2, f3);
+        }
+        else if constexpr (count == 5) {
+            auto& [f0, f1, f2, f3, f4] = value;
+            return std::tie(f0, f1, f2, f3, f4);
+        }
+        else if constexpr (count == 6) {
+            auto& [f0, f1, f2, f3, f4, f5] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5);
+        }
+        else if constexpr (count == 7) {
+            auto& [f0, f1, f2, f3, f4, f5, f6] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6);
+        }
+        else if constexpr (count == 8) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+        }
+        else if constexpr (count == 9) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+        }
+        else if constexpr (count == 10) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+        }
+        else if constexpr (count == 11) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+        }
+        else {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+        }
+    }
+
+    template<std::size_t I>
+    using type = std::remove_cvref_t<std::tuple_element_t<I, decltype(tie(std::declval<T&>()))>>;
+};
+
+template <typename T>
+class ColumnList {
+    static_assert(std::is_aggregate_v<T> && !std::is_array_v<T>, "ColumnList requires an aggregate struct");
+    static_assert(AggregateFields<T>::count > 0, "ColumnList requires at least one field");
+
+public:
+    static constexpr std::size_t field_count = AggregateFields<T>::count;
+
+    template<std::size_t I>
+    using field_type = typename AggregateFields<T>::template type<I>;
+
+private:
+    static_assert([]<std::size_t... I>(std::index_sequence<I...>) {
+        return (std::is_nothrow_move_constructible_v<field_type<I>> && ...);
+    }(std::make_index_sequence<field_count>{}), "ColumnList fields must be nothrow move constructible");
+
+    static constexpr std::size_t chunk_capacity = COLUMN_LIST_CHUNK_SIZE;
+
+    template<typename F>
+    struct Column {
+        alignas(F) unsigned char bytes[chunk_capacity * sizeof(F)];
+    };
+
+    template<std::size_t... I>
+    static auto column_storage(std::index_sequence<I...>) -> std::tuple<Column<field_type<I>>...>;
+
+    struct Chunk {
+        decltype(column_storage(std::make_index_sequence<field_count>{})) columns;
+        Chunk* next;
+        Chunk* prev;
+        std::size_t count;
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+    };
+
+    Chunk* head;
+    Chunk* tail;
+    std::size_t size;
+
+    template<std::size_t I>
+    static field_type<I>* column(Chunk*);
+
+    template<std::size_t I>
+    static const field_type<I>* column(const Chunk*);
+
+    template<typename F>
+    static void for_each_field(F&&);
+
+    static void construct(Chunk*, std::size_t, T&&);
+    static void destroy(Chunk*, std::size_t);
+    static void relocate(Chunk*, std::size_t, Chunk*, std::size_t);
+    static T assemble(const Chunk*, std::size_t);
+    Chunk* new_chunk_after(Chunk*);
+    void free_chunk(Chunk*);
+    Chunk* split(Chunk*);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    class reference {
+    public:
+        reference(Chunk*, std::size_t);
+        operator T() const;
+        reference& operator=(const T&);
+        reference& operator=(const reference&);
+
+        template<std::size_t I>
+        field_type<I>& get() const;
+    private:
+        Chunk* chunk;
+        std::size_t index;
+    };
+
+    class const_reference {
+    public:
+        const_reference(const Chunk*, std::size_t);
+        operator T() const;
+
+        template<std::size_t I>
+        const field_type<I>& get() const;
+    private:
+        const Chunk* chunk;
+        std::size_t index;
+    };
+
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = ColumnList::reference;
+
+        iterator(const ColumnList*, Chunk*, std::size_t);
+        reference operator*() const;
+        iterator& operator++();
+        iterator& operator--();
+        iterator operator++(int);
+        iterator operator--(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+        friend class ColumnList<T>;
+    private:
+        const ColumnList* owner;
+        Chunk* chunk;
+        std::size_t index;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = ColumnList::const_reference;
+
+        const_iterator(const ColumnList*, const Chunk*, std::size_t);
+        reference operator*() const;
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int);
+        const_iterator operator--(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+    private:
+        const ColumnList* owner;
+        const Chunk* chunk;
+        std::size_t index;
+    };
+
+    ColumnList();
+    ColumnList(std::initializer_list<T>);
+    ColumnList(const ColumnList&);
+    ColumnList& operator=(const ColumnList&);
+    ~ColumnList();
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    void push_back(const T&);
+    void push_back(T&&);
+    void push_front(const T&);
+    void push_front(T&&);
+
+    template<typename... Args>
+    reference emplace_back(Args&&...);
+
+    void pop_back();
+    void pop_front();
+    iterator insert(iterator, const T&);
+    iterator erase(iterator);
+    void clear();
+    void swap(ColumnList&) noexcept;
+
+    iterator begin();
+    iterator end();
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+    template<std::size_t I, typename F>
+    void for_each_column(F&&);
+
+    template<std::size_t I, typename F>
+    void for_each_column(F&&) const;
+
+    template<std::size_t I>
+    iterator find(const field_type<I>&);
+
+    template<std::size_t I>
+    const_iterator find(const field_type<I>&) const;
+
+    template<std::size_t I>
+    size_type count(const field_type<I>&) const;
+
+    template<std::size_t I>
+    field_type<I> min() const;
+
+    template<std::size_t I>
+    field_type<I> max() const;
+
+    template<std::size_t I>
+    field_type<I> sum() const;
+
+    size_type chunk_count() const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "columnListImplementation.tpp"
+
+#endif
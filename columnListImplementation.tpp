@@ -0,0 +1,1017 @@
+#include "columnListHeader.hpp"
+
+/**
+ * @brief Allocates a chunk from the shared slab pool.
+ *
+ * @param bytes The size of the chunk, always `sizeof(Chunk)`.
+ * @return Storage for one chunk.
+ */
+template <typename T>
+void* ColumnList<T>::Chunk::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Chunk), alignof(Chunk)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a chunk's storage to the shared slab pool.
+ *
+ * @param ptr The chunk storage to release.
+ */
+template <typename T>
+void ColumnList<T>::Chunk::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Chunk), alignof(Chunk)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Returns the array holding one field of every element in a chunk.
+ *
+ * @tparam I The index of the field.
+ * @param chunk The chunk.
+ * @return A pointer to the field of the chunk's first element.
+ */
+template <typename T>
+template <std::size_t I>
+typename ColumnList<T>::template field_type<I>* ColumnList<T>::column(Chunk* chunk) {
+    return std::launder(reinterpret_cast<field_type<I>*>(std::get<I>(chunk->columns).bytes));
+}
+
+/**
+ * @brief Returns the read-only array holding one field of every element in a chunk.
+ *
+ * @tparam I The index of the field.
+ * @param chunk The chunk.
+ * @return A pointer to the field of the chunk's first element.
+ */
+template <typename T>
+template <std::size_t I>
+const typename ColumnList<T>::template field_type<I>* ColumnList<T>::column(const Chunk* chunk) {
+    return std::launder(reinterpret_cast<const field_type<I>*>(std::get<I>(chunk->columns).bytes));
+}
+
+/**
+ * @brief Calls a function once per field, with the field index as an `std::integral_constant`.
+ *
+ * @param fn Callable as `fn(std::integral_constant<std::size_t, I>)`.
+ */
+template <typename T>
+template <typename F>
+void ColumnList<T>::for_each_field(F&& fn) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (fn(std::integral_constant<std::size_t, I>{}), ...);
+    }(std::make_index_sequence<field_count>{});
+}
+
+/**
+ * @brief Scatters an element's fields into a free slot of a chunk.
+ *
+ * @param chunk The chunk.
+ * @param index The slot to construct.
+ * @param value The element whose fields are moved into the columns.
+ */
+template <typename T>
+void ColumnList<T>::construct(Chunk* chunk, std::size_t index, T&& value) {
+    auto fields = AggregateFields<T>::tie(value);
+    for_each_field([&](auto field) {
+        constexpr std::size_t I = decltype(field)::value;
+        ::new (static_cast<void*>(column<I>(chunk) + index)) field_type<I>(std::move(std::get<I>(fields)));
+    });
+}
+
+/**
+ * @brief Destroys the fields of one slot of a chunk.
+ *
+ * @param chunk The chunk.
+ * @param index The slot to destroy.
+ */
+template <typename T>
+void ColumnList<T>::destroy(Chunk* chunk, std::size_t index) {
+    for_each_field([&](auto field) {
+        std::destroy_at(column<decltype(field)::value>(chunk) + index);
+    });
+}
+
+/**
+ * @brief Moves the fields of one slot into a free slot, possibly of another chunk, and destroys the source.
+ *
+ * @param to The destination chunk.
+ * @param to_index The free destination slot.
+ * @param from The source chunk.
+ * @param from_index The source slot.
+ */
+template <typename T>
+void ColumnList<T>::relocate(Chunk* to, std::size_t to_index, Chunk* from, std::size_t from_index) {
+    for_each_field([&](auto field) {
+        constexpr std::size_t I = decltype(field)::value;
+        field_type<I>* source = column<I>(from) + from_index;
+        ::new (static_cast<void*>(column<I>(to) + to_index)) field_type<I>(std::move(*source));
+        std::destroy_at(source);
+    });
+}
+
+/**
+ * @brief Gathers the fields of one slot back into an element.
+ *
+ * @param chunk The chunk.
+ * @param index The slot to read.
+ * @return A copy of the element.
+ */
+template <typename T>
+T ColumnList<T>::assemble(const Chunk* chunk, std::size_t index) {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return T{column<I>(chunk)[index]...};
+    }(std::make_index_sequence<field_count>{});
+}
+
+/**
+ * @brief Allocates an empty chunk and links it after another chunk.
+ *
+ * @param chunk The chunk to link after, or nullptr to link the new chunk at the front.
+ * @return The new chunk.
+ */
+template <typename T>
+typename ColumnList<T>::Chunk* ColumnList<T>::new_chunk_after(Chunk* chunk) {
+    Chunk* fresh = new Chunk;
+    fresh->count = 0;
+    fresh->prev = chunk;
+    fresh->next = chunk ? chunk->next : head;
+    if (fresh->next) {
+        fresh->next->prev = fresh;
+    }
+    else {
+        tail = fresh;
+    }
+    if (chunk) {
+        chunk->next = fresh;
+    }
+    else {
+        head = fresh;
+    }
+    return fresh;
+}
+
+/**
+ * @brief Unlinks and frees a chunk whose elements have already been destroyed or moved out.
+ *
+ * @param chunk The chunk to free.
+ */
+template <typename T>
+void ColumnList<T>::free_chunk(Chunk* chunk) {
+    if (chunk->prev) {
+        chunk->prev->next = chunk->next;
+    }
+    else {
+        head = chunk->next;
+    }
+    if (chunk->next) {
+        chunk->next->prev = chunk->prev;
+    }
+    else {
+        tail = chunk->prev;
+    }
+    delete chunk;
+}
+
+/**
+ * @brief Moves the upper half of a full chunk into a new chunk linked right after it.
+ *
+ * @param chunk The full chunk to split.
+ * @return The new chunk holding the upper half.
+ */
+template <typename T>
+typename ColumnList<T>::Chunk* ColumnList<T>::split(Chunk* chunk) {
+    constexpr std::size_t half = chunk_capacity / 2;
+    Chunk* upper = new_chunk_after(chunk);
+    for (std::size_t i = half; i < chunk_capacity; ++i) {
+        relocate(upper, upper->count++, chunk, i);
+    }
+    chunk->count = half;
+    return upper;
+}
+
+/**
+ * @brief Constructor for a proxy reference.
+ *
+ * @param c The chunk holding the element.
+ * @param i The element's slot within the chunk.
+ */
+template <typename T>
+ColumnList<T>::reference::reference(Chunk* c, std::size_t i) : chunk(c), index(i) { }
+
+/**
+ * @brief Gathers the referenced element's fields into a copy.
+ *
+ * @return A copy of the element.
+ */
+template <typename T>
+ColumnList<T>::reference::operator T() const {
+    return assemble(chunk, index);
+}
+
+/**
+ * @brief Scatters a value into the referenced element's fields.
+ *
+ * @param value The value to store.
+ * @return This reference.
+ */
+template <typename T>
+typename ColumnList<T>::reference& ColumnList<T>::reference::operator=(const T& value) {
+    auto fields = AggregateFields<T>::tie(value);
+    for_each_field([&](auto field) {
+        constexpr std::size_t I = decltype(field)::value;
+        column<I>(chunk)[index] = std::get<I>(fields);
+    });
+    return *this;
+}
+
+/**
+ * @brief Copies the element referenced by another proxy into this one.
+ *
+ * @param other The proxy to read from.
+ * @return This reference.
+ */
+template <typename T>
+typename ColumnList<T>::reference& ColumnList<T>::reference::operator=(const reference& other) {
+    return *this = static_cast<T>(other);
+}
+
+/**
+ * @brief Accesses one field of the referenced element in place.
+ *
+ * @tparam I The index of the field.
+ * @return A reference to the field.
+ */
+template <typename T>
+template <std::size_t I>
+typename ColumnList<T>::template field_type<I>& ColumnList<T>::reference::get() const {
+    return column<I>(chunk)[index];
+}
+
+/**
+ * @brief Constructor for a read-only proxy reference.
+ *
+ * @param c The chunk holding the element.
+ * @param i The element's slot within the chunk.
+ */
+template <typename T>
+ColumnList<T>::const_reference::const_reference(const Chunk* c, std::size_t i) : chunk(c), index(i) { }
+
+/**
+ * @brief Gathers the referenced element's fields into a copy.
+ *
+ * @return A copy of the element.
+ */
+template <typename T>
+ColumnList<T>::const_reference::operator T() const {
+    return assemble(chunk, index);
+}
+
+/**
+ * @brief Reads one field of the referenced element in place.
+ *
+ * @tparam I The index of the field.
+ * @return A const reference to the field.
+ */
+template <typename T>
+template <std::size_t I>
+const typename ColumnList<T>::template field_type<I>& ColumnList<T>::const_reference::get() const {
+    return column<I>(chunk)[index];
+}
+
+/**
+ * @brief Constructor for an iterator.
+ *
+ * @param list The list the iterator belongs to, used to step back from `end()`.
+ * @param c The chunk holding the element, or nullptr for `end()`.
+ * @param i The element's slot within the chunk.
+ */
+template <typename T>
+ColumnList<T>::iterator::iterator(const ColumnList* list, Chunk* c, std::size_t i) : owner(list), chunk(c), index(i) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A proxy reference to the current element.
+ */
+template <typename T>
+typename ColumnList<T>::reference ColumnList<T>::iterator::operator*() const {
+    return reference(chunk, index);
+}
+
+/**
+ * @brief Pre-increment operator for iterator.
+ *
+ * @return A reference to the incremented iterator.
+ */
+template <typename T>
+typename ColumnList<T>::iterator& ColumnList<T>::iterator::operator++() {
+    if (++index == chunk->count) {
+        chunk = chunk->next;
+        index = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Pre-decrement operator for iterator.
+ *
+ * Decrementing `end()` moves to the last element.
+ *
+ * @return A reference to the decremented iterator.
+ */
+template <typename T>
+typename ColumnList<T>::iterator& ColumnList<T>::iterator::operator--() {
+    if (!chunk) {
+        chunk = owner->tail;
+        index = chunk->count - 1;
+    }
+    else if (index == 0) {
+        chunk = chunk->prev;
+        index = chunk->count - 1;
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Post-increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename ColumnList<T>::iterator ColumnList<T>::iterator::operator++(int) {
+    iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+/**
+ * @brief Post-decrement operator for iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename ColumnList<T>::iterator ColumnList<T>::iterator::operator--(int) {
+    iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+/**
+ * @brief Equality operator for iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if both iterators point to the same element.
+ */
+template <typename T>
+bool ColumnList<T>::iterator::operator==(const iterator& other) const {
+    return chunk == other.chunk && index == other.index;
+}
+
+/**
+ * @brief Inequality operator for iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if the iterators point to different elements.
+ */
+template <typename T>
+bool ColumnList<T>::iterator::operator!=(const iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructor for a const iterator.
+ *
+ * @param list The list the iterator belongs to, used to step back from `cend()`.
+ * @param c The chunk holding the element, or nullptr for `cend()`.
+ * @param i The element's slot within the chunk.
+ */
+template <typename T>
+ColumnList<T>::const_iterator::const_iterator(const ColumnList* list, const Chunk* c, std::size_t i)
+    : owner(list), chunk(c), index(i) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return A read-only proxy reference to the current element.
+ */
+template <typename T>
+typename ColumnList<T>::const_reference ColumnList<T>::const_iterator::operator*() const {
+    return const_reference(chunk, index);
+}
+
+/**
+ * @brief Pre-increment operator for const iterator.
+ *
+ * @return A reference to the incremented iterator.
+ */
+template <typename T>
+typename ColumnList<T>::const_iterator& ColumnList<T>::const_iterator::operator++() {
+    if (++index == chunk->count) {
+        chunk = chunk->next;
+        index = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Pre-decrement operator for const iterator.
+ *
+ * Decrementing `cend()` moves to the last element.
+ *
+ * @return A reference to the decremented iterator.
+ */
+template <typename T>
+typename ColumnList<T>::const_iterator& ColumnList<T>::const_iterator::operator--() {
+    if (!chunk) {
+        chunk = owner->tail;
+        index = chunk->count - 1;
+    }
+    else if (index == 0) {
+        chunk = chunk->prev;
+        index = chunk->count - 1;
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Post-increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename ColumnList<T>::const_iterator ColumnList<T>::const_iterator::operator++(int) {
+    const_iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+/**
+ * @brief Post-decrement operator for const iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename ColumnList<T>::const_iterator ColumnList<T>::const_iterator::operator--(int) {
+    const_iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+/**
+ * @brief Equality operator for const iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if both iterators point to the same element.
+ */
+template <typename T>
+bool ColumnList<T>::const_iterator::operator==(const const_iterator& other) const {
+    return chunk == other.chunk && index == other.index;
+}
+
+/**
+ * @brief Inequality operator for const iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if the iterators point to different elements.
+ */
+template <typename T>
+bool ColumnList<T>::const_iterator::operator!=(const const_iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructs an empty list.
+ */
+template <typename T>
+ColumnList<T>::ColumnList() : head(nullptr), tail(nullptr), size(0) { }
+
+/**
+ * @brief Constructs a list from an initializer list.
+ *
+ * @param values The elements to append.
+ */
+template <typename T>
+ColumnList<T>::ColumnList(std::initializer_list<T> values) : ColumnList() {
+    for (const T& value : values) {
+        push_back(value);
+    }
+}
+
+/**
+ * @brief Copy constructor, gathering each element of another list and scattering it into this one.
+ *
+ * @param other The list to copy from.
+ */
+template <typename T>
+ColumnList<T>::ColumnList(const ColumnList& other) : ColumnList() {
+    for (const Chunk* chunk = other.head; chunk; chunk = chunk->next) {
+        for (std::size_t i = 0; i < chunk->count; ++i) {
+            push_back(assemble(chunk, i));
+        }
+    }
+}
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param other The list to copy from.
+ * @return A reference to this list.
+ */
+template <typename T>
+ColumnList<T>& ColumnList<T>::operator=(const ColumnList& other) {
+    if (this != &other) {
+        ColumnList copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys the list and frees all chunks.
+ */
+template <typename T>
+ColumnList<T>::~ColumnList() {
+    clear();
+}
+
+/**
+ * @brief Accesses the first element.
+ *
+ * @return A proxy reference to the first element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename ColumnList<T>::reference ColumnList<T>::front() {
+    if (!head) {
+        throw std::out_of_range("List is empty");
+    }
+    return reference(head, 0);
+}
+
+/**
+ * @brief Reads the first element.
+ *
+ * @return A read-only proxy reference to the first element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename ColumnList<T>::const_reference ColumnList<T>::front() const {
+    if (!head) {
+        throw std::out_of_range("List is empty");
+    }
+    return const_reference(head, 0);
+}
+
+/**
+ * @brief Accesses the last element.
+ *
+ * @return A proxy reference to the last element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename ColumnList<T>::reference ColumnList<T>::back() {
+    if (!tail) {
+        throw std::out_of_range("List is empty");
+    }
+    return reference(tail, tail->count - 1);
+}
+
+/**
+ * @brief Reads the last element.
+ *
+ * @return A read-only proxy reference to the last element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename ColumnList<T>::const_reference ColumnList<T>::back() const {
+    if (!tail) {
+        throw std::out_of_range("List is empty");
+    }
+    return const_reference(tail, tail->count - 1);
+}
+
+/**
+ * @brief Appends a copy of an element.
+ *
+ * @param value The element to append.
+ */
+template <typename T>
+void ColumnList<T>::push_back(const T& value) {
+    push_back(T(value));
+}
+
+/**
+ * @brief Appends an element, moving its fields into the columns.
+ *
+ * A new chunk is linked at the back when the last one is full.
+ *
+ * @param value The element to append.
+ */
+template <typename T>
+void ColumnList<T>::push_back(T&& value) {
+    if (!tail || tail->count == chunk_capacity) {
+        new_chunk_after(tail);
+    }
+    construct(tail, tail->count, std::move(value));
+    ++tail->count;
+    ++size;
+}
+
+/**
+ * @brief Prepends a copy of an element.
+ *
+ * @param value The element to prepend.
+ */
+template <typename T>
+void ColumnList<T>::push_front(const T& value) {
+    push_front(T(value));
+}
+
+/**
+ * @brief Prepends an element, moving its fields into the columns.
+ *
+ * A new chunk is linked at the front when the first one is full; otherwise the first chunk's
+ * elements shift up by one slot.
+ *
+ * @param value The element to prepend.
+ */
+template <typename T>
+void ColumnList<T>::push_front(T&& value) {
+    if (!head || head->count == chunk_capacity) {
+        new_chunk_after(nullptr);
+    }
+    for (std::size_t i = head->count; i > 0; --i) {
+        relocate(head, i, head, i - 1);
+    }
+    construct(head, 0, std::move(value));
+    ++head->count;
+    ++size;
+}
+
+/**
+ * @brief Appends an element aggregate-initialized from the given arguments.
+ *
+ * @param args The field values, in declaration order.
+ * @return A proxy reference to the new element.
+ */
+template <typename T>
+template <typename... Args>
+typename ColumnList<T>::reference ColumnList<T>::emplace_back(Args&&... args) {
+    push_back(T{std::forward<Args>(args)...});
+    return back();
+}
+
+/**
+ * @brief Removes the last element; does nothing if the list is empty.
+ */
+template <typename T>
+void ColumnList<T>::pop_back() {
+    if (!tail) {
+        return;
+    }
+    destroy(tail, --tail->count);
+    --size;
+    if (tail->count == 0) {
+        free_chunk(tail);
+    }
+}
+
+/**
+ * @brief Removes the first element; does nothing if the list is empty.
+ */
+template <typename T>
+void ColumnList<T>::pop_front() {
+    if (!head) {
+        return;
+    }
+    erase(begin());
+}
+
+/**
+ * @brief Inserts a copy of an element before a position.
+ *
+ * The elements after the position within its chunk shift up by one slot. A full chunk is first
+ * split in two, so insertion never touches more than one chunk's worth of elements.
+ *
+ * @param pos The position to insert before; `end()` appends.
+ * @param value The element to insert.
+ * @return An iterator to the inserted element.
+ */
+template <typename T>
+typename ColumnList<T>::iterator ColumnList<T>::insert(iterator pos, const T& value) {
+    if (!pos.chunk) {
+        push_back(value);
+        return iterator(this, tail, tail->count - 1);
+    }
+    T copy(value);
+    Chunk* chunk = pos.chunk;
+    std::size_t index = pos.index;
+    if (chunk->count == chunk_capacity) {
+        Chunk* upper = split(chunk);
+        if (index > chunk->count) {
+            index -= chunk->count;
+            chunk = upper;
+        }
+    }
+    for (std::size_t i = chunk->count; i > index; --i) {
+        relocate(chunk, i, chunk, i - 1);
+    }
+    construct(chunk, index, std::move(copy));
+    ++chunk->count;
+    ++size;
+    return iterator(this, chunk, index);
+}
+
+/**
+ * @brief Removes the element at a position.
+ *
+ * The elements after it within its chunk shift down by one slot. An emptied chunk is freed, and a
+ * chunk that, together with its successor, is at most half full absorbs the successor, so scans
+ * keep running over long columns.
+ *
+ * @param pos The element to remove; must not be `end()`.
+ * @return An iterator to the element that followed the removed one.
+ */
+template <typename T>
+typename ColumnList<T>::iterator ColumnList<T>::erase(iterator pos) {
+    Chunk* chunk = pos.chunk;
+    std::size_t index = pos.index;
+    destroy(chunk, index);
+    for (std::size_t i = index + 1; i < chunk->count; ++i) {
+        relocate(chunk, i - 1, chunk, i);
+    }
+    --chunk->count;
+    --size;
+    Chunk* next = chunk->next;
+    if (chunk->count == 0) {
+        free_chunk(chunk);
+        return iterator(this, next, 0);
+    }
+    if (next && chunk->count + next->count <= chunk_capacity / 2) {
+        for (std::size_t i = 0; i < next->count; ++i) {
+            relocate(chunk, chunk->count++, next, i);
+        }
+        free_chunk(next);
+    }
+    if (index < chunk->count) {
+        return iterator(this, chunk, index);
+    }
+    return iterator(this, chunk->next, 0);
+}
+
+/**
+ * @brief Removes all elements and frees every chunk.
+ */
+template <typename T>
+void ColumnList<T>::clear() {
+    while (head) {
+        Chunk* next = head->next;
+        for (std::size_t i = 0; i < head->count; ++i) {
+            destroy(head, i);
+        }
+        delete head;
+        head = next;
+    }
+    tail = nullptr;
+    size = 0;
+}
+
+/**
+ * @brief Swaps the contents of two lists in O(1).
+ *
+ * @param other The list to swap with.
+ */
+template <typename T>
+void ColumnList<T>::swap(ColumnList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(size, other.size);
+}
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return An iterator to the first element, or `end()` if the list is empty.
+ */
+template <typename T>
+typename ColumnList<T>::iterator ColumnList<T>::begin() {
+    return iterator(this, head, 0);
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return The end iterator.
+ */
+template <typename T>
+typename ColumnList<T>::iterator ColumnList<T>::end() {
+    return iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Returns a const iterator to the first element.
+ *
+ * @return A const iterator to the first element, or `cend()` if the list is empty.
+ */
+template <typename T>
+typename ColumnList<T>::const_iterator ColumnList<T>::cbegin() const {
+    return const_iterator(this, head, 0);
+}
+
+/**
+ * @brief Returns a const iterator past the last element.
+ *
+ * @return The const end iterator.
+ */
+template <typename T>
+typename ColumnList<T>::const_iterator ColumnList<T>::cend() const {
+    return const_iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Calls a function on each chunk's column of one field.
+ *
+ * The spans point straight into the list's storage, so writes through them update the elements.
+ *
+ * @tparam I The index of the field.
+ * @param fn Callable as `fn(std::span<field_type<I>>)`.
+ */
+template <typename T>
+template <std::size_t I, typename F>
+void ColumnList<T>::for_each_column(F&& fn) {
+    for (Chunk* chunk = head; chunk; chunk = chunk->next) {
+        fn(std::span<field_type<I>>(column<I>(chunk), chunk->count));
+    }
+}
+
+/**
+ * @brief Calls a function on each chunk's read-only column of one field.
+ *
+ * @tparam I The index of the field.
+ * @param fn Callable as `fn(std::span<const field_type<I>>)`.
+ */
+template <typename T>
+template <std::size_t I, typename F>
+void ColumnList<T>::for_each_column(F&& fn) const {
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        fn(std::span<const field_type<I>>(column<I>(chunk), chunk->count));
+    }
+}
+
+/**
+ * @brief Finds the first element whose field equals a value.
+ *
+ * Only the field's column is read, using the `ListKernels` vector kernels.
+ *
+ * @tparam I The index of the field.
+ * @param value The value to look for.
+ * @return An iterator to the first matching element, or `end()` if there is none.
+ */
+template <typename T>
+template <std::size_t I>
+typename ColumnList<T>::iterator ColumnList<T>::find(const field_type<I>& value) {
+    for (Chunk* chunk = head; chunk; chunk = chunk->next) {
+        std::size_t index = ListKernels<field_type<I>>::find(column<I>(chunk), chunk->count, value);
+        if (index < chunk->count) {
+            return iterator(this, chunk, index);
+        }
+    }
+    return end();
+}
+
+/**
+ * @brief Finds the first element whose field equals a value.
+ *
+ * @tparam I The index of the field.
+ * @param value The value to look for.
+ * @return A const iterator to the first matching element, or `cend()` if there is none.
+ */
+template <typename T>
+template <std::size_t I>
+typename ColumnList<T>::const_iterator ColumnList<T>::find(const field_type<I>& value) const {
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        std::size_t index = ListKernels<field_type<I>>::find(column<I>(chunk), chunk->count, value);
+        if (index < chunk->count) {
+            return const_iterator(this, chunk, index);
+        }
+    }
+    return cend();
+}
+
+/**
+ * @brief Counts the elements whose field equals a value.
+ *
+ * @tparam I The index of the field.
+ * @param value The value to count.
+ * @return The number of matching elements.
+ */
+template <typename T>
+template <std::size_t I>
+typename ColumnList<T>::size_type ColumnList<T>::count(const field_type<I>& value) const {
+    size_type matches = 0;
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        matches += ListKernels<field_type<I>>::count(column<I>(chunk), chunk->count, value);
+    }
+    return matches;
+}
+
+/**
+ * @brief Returns the smallest value of one field.
+ *
+ * @tparam I The index of the field.
+ * @return A copy of the smallest value.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+template <std::size_t I>
+typename ColumnList<T>::template field_type<I> ColumnList<T>::min() const {
+    if (!head) {
+        throw std::out_of_range("List is empty");
+    }
+    field_type<I> best = column<I>(head)[0];
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        field_type<I> candidate = ListKernels<field_type<I>>::min(column<I>(chunk), chunk->count);
+        if (candidate < best) {
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Returns the largest value of one field.
+ *
+ * @tparam I The index of the field.
+ * @return A copy of the largest value.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+template <std::size_t I>
+typename ColumnList<T>::template field_type<I> ColumnList<T>::max() const {
+    if (!head) {
+        throw std::out_of_range("List is empty");
+    }
+    field_type<I> best = column<I>(head)[0];
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        field_type<I> candidate = ListKernels<field_type<I>>::max(column<I>(chunk), chunk->count);
+        if (best < candidate) {
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Sums one field over all elements.
+ *
+ * @tparam I The index of the field.
+ * @return The sum, or a value-initialized field if the list is empty.
+ */
+template <typename T>
+template <std::size_t I>
+typename ColumnList<T>::template field_type<I> ColumnList<T>::sum() const {
+    field_type<I> total{};
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        total += ListKernels<field_type<I>>::sum(column<I>(chunk), chunk->count);
+    }
+    return total;
+}
+
+/**
+ * @brief Returns the number of chunks currently linked.
+ *
+ * @return The chunk count.
+ */
+template <typename T>
+typename ColumnList<T>::size_type ColumnList<T>::chunk_count() const {
+    size_type chunks = 0;
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        ++chunks;
+    }
+    return chunks;
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @return The number of elements.
+ */
+template <typename T>
+typename ColumnList<T>::size_type ColumnList<T>::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * @return True if the list holds no elements.
+ */
+template <typename T>
+bool ColumnList<T>::empty() const {
+    return size == 0;
+}
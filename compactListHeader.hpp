@@ -0,0 +1,123 @@
+#ifndef COMPACT_LIST_H
+#define COMPACT_LIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "nodePoolHeader.hpp"
+
+template <typename T>
+class CompactList {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        template<typename... Args>
+        Node(Args&&...);
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+    };
+
+    Node* tail;
+
+    void link_back(Node*);
+    void link_front(Node*);
+    Node* link_after(Node*, Node*);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator();
+        iterator(Node*, const CompactList*);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator operator++(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+        friend class CompactList<T>;
+    private:
+        Node* node_ptr;
+        const CompactList* owner;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = const T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator();
+        const_iterator(Node*, const CompactList*);
+        const_iterator(const iterator&);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+        friend class CompactList<T>;
+    private:
+        Node* node_ptr;
+        const CompactList* owner;
+    };
+
+    CompactList() noexcept;
+    CompactList(const CompactList&);
+    CompactList(CompactList&&) noexcept;
+    CompactList& operator=(const CompactList&);
+    CompactList& operator=(CompactList&&) noexcept;
+    ~CompactList();
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    void push_back(const T&);
+    void push_back(T&&);
+    void push_front(const T&);
+    void push_front(T&&);
+
+    template<typename... Args>
+    reference emplace_back(Args&&...);
+
+    template<typename... Args>
+    reference emplace_front(Args&&...);
+
+    void pop_front();
+    iterator insert_after(const_iterator, const T&);
+    iterator insert_after(const_iterator, T&&);
+    iterator erase_after(const_iterator);
+    void clear() noexcept;
+    void swap(CompactList&) noexcept;
+
+    iterator before_begin();
+    iterator begin();
+    iterator end();
+    const_iterator cbefore_begin() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "compactListImplementation.tpp"
+
+#endif
@@ -0,0 +1,645 @@
+#include "compactListHeader.hpp"
+
+/**
+ * @brief Variadic constructor for a compact list node, forwarding arguments to construct the node's data.
+ *
+ * @param args The arguments to construct the node's data.
+ */
+template <typename T>
+template<typename... Args>
+CompactList<T>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) { }
+
+/**
+ * @brief Allocates a node from the shared slab pool.
+ *
+ * @param bytes The size of the node, always `sizeof(Node)`.
+ * @return Storage for one node.
+ */
+template <typename T>
+void* CompactList<T>::Node::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Node), alignof(Node)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a node's storage to the shared slab pool.
+ *
+ * @param ptr The node storage to release.
+ */
+template <typename T>
+void CompactList<T>::Node::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Node), alignof(Node)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Links a new node after the current tail, making it the new tail.
+ *
+ * @param node The node to link.
+ */
+template <typename T>
+void CompactList<T>::link_back(Node* node) {
+    link_front(node);
+    tail = node;
+}
+
+/**
+ * @brief Links a new node between the tail and the current head, making it the new head.
+ *
+ * @param node The node to link.
+ */
+template <typename T>
+void CompactList<T>::link_front(Node* node) {
+    if (!tail) {
+        node->next = node;
+        tail = node;
+    }
+    else {
+        node->next = tail->next;
+        tail->next = node;
+    }
+}
+
+/**
+ * @brief Links a new node after another one, or at the front when there is no predecessor.
+ *
+ * @param before The node to link after, or nullptr for the position before the first element.
+ * @param node The node to link.
+ * @return The linked node.
+ */
+template <typename T>
+typename CompactList<T>::Node* CompactList<T>::link_after(Node* before, Node* node) {
+    if (!before) {
+        link_front(node);
+        return node;
+    }
+    node->next = before->next;
+    before->next = node;
+    if (before == tail) {
+        tail = node;
+    }
+    return node;
+}
+
+/**
+ * @brief Constructs a singular iterator.
+ */
+template <typename T>
+CompactList<T>::iterator::iterator() : node_ptr(nullptr), owner(nullptr) { }
+
+/**
+ * @brief Constructor for an iterator, initializing it with a node pointer.
+ *
+ * @param ptr The node the iterator will reference, or nullptr for `end()`.
+ * @param list The list the node belongs to, used to detect the end of the circular chain.
+ */
+template <typename T>
+CompactList<T>::iterator::iterator(Node* ptr, const CompactList* list) : node_ptr(ptr), owner(list) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A reference to the data stored in the current node.
+ */
+template <typename T>
+typename CompactList<T>::iterator::reference CompactList<T>::iterator::operator*() const {
+    return node_ptr->data;
+}
+
+/**
+ * @brief Arrow operator for iterator.
+ *
+ * @return A pointer to the data stored in the current node.
+ */
+template <typename T>
+typename CompactList<T>::iterator::pointer CompactList<T>::iterator::operator->() const {
+    return &node_ptr->data;
+}
+
+/**
+ * @brief Prefix increment operator for iterator, stopping after the tail instead of wrapping around.
+ *
+ * Incrementing `before_begin()` yields `begin()`.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename CompactList<T>::iterator& CompactList<T>::iterator::operator++() {
+    if (node_ptr == owner->tail) {
+        node_ptr = nullptr;
+    }
+    else {
+        node_ptr = node_ptr ? node_ptr->next : owner->tail->next;
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::iterator::operator++(int) {
+    iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators point to the same node, false otherwise.
+ */
+template <typename T>
+bool CompactList<T>::iterator::operator==(const iterator& other) const {
+    return node_ptr == other.node_ptr;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators point to different nodes, false otherwise.
+ */
+template <typename T>
+bool CompactList<T>::iterator::operator!=(const iterator& other) const {
+    return node_ptr != other.node_ptr;
+}
+
+/**
+ * @brief Constructs a singular const iterator.
+ */
+template <typename T>
+CompactList<T>::const_iterator::const_iterator() : node_ptr(nullptr), owner(nullptr) { }
+
+/**
+ * @brief Constructor for a const iterator, initializing it with a node pointer.
+ *
+ * @param ptr The node the iterator will reference, or nullptr for `cend()`.
+ * @param list The list the node belongs to.
+ */
+template <typename T>
+CompactList<T>::const_iterator::const_iterator(Node* ptr, const CompactList* list) : node_ptr(ptr), owner(list) { }
+
+/**
+ * @brief Converts a mutable iterator to a const iterator at the same position.
+ *
+ * @param it The iterator to convert.
+ */
+template <typename T>
+CompactList<T>::const_iterator::const_iterator(const iterator& it) : node_ptr(it.node_ptr), owner(it.owner) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return A const reference to the data stored in the current node.
+ */
+template <typename T>
+typename CompactList<T>::const_iterator::reference CompactList<T>::const_iterator::operator*() const {
+    return node_ptr->data;
+}
+
+/**
+ * @brief Arrow operator for const iterator.
+ *
+ * @return A const pointer to the data stored in the current node.
+ */
+template <typename T>
+typename CompactList<T>::const_iterator::pointer CompactList<T>::const_iterator::operator->() const {
+    return &node_ptr->data;
+}
+
+/**
+ * @brief Prefix increment operator for const iterator, stopping after the tail.
+ *
+ * Incrementing `cbefore_begin()` yields `cbegin()`.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename CompactList<T>::const_iterator& CompactList<T>::const_iterator::operator++() {
+    if (node_ptr == owner->tail) {
+        node_ptr = nullptr;
+    }
+    else {
+        node_ptr = node_ptr ? node_ptr->next : owner->tail->next;
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename CompactList<T>::const_iterator CompactList<T>::const_iterator::operator++(int) {
+    const_iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators point to the same node, false otherwise.
+ */
+template <typename T>
+bool CompactList<T>::const_iterator::operator==(const const_iterator& other) const {
+    return node_ptr == other.node_ptr;
+}
+
+/**
+ * @brief Inequality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators point to different nodes, false otherwise.
+ */
+template <typename T>
+bool CompactList<T>::const_iterator::operator!=(const const_iterator& other) const {
+    return node_ptr != other.node_ptr;
+}
+
+/**
+ * @brief Constructs an empty list.
+ *
+ * The whole header is one pointer to the tail of a circular singly linked chain; the head is
+ * `tail->next`, so an empty list costs exactly `sizeof(void*)` bytes and allocates nothing.
+ */
+template <typename T>
+CompactList<T>::CompactList() noexcept : tail(nullptr) { }
+
+/**
+ * @brief Copy constructor, performing a deep copy of the elements.
+ *
+ * @param other The list to copy from.
+ */
+template <typename T>
+CompactList<T>::CompactList(const CompactList& other) : tail(nullptr) {
+    for (auto it = other.cbegin(); it != other.cend(); ++it) {
+        push_back(*it);
+    }
+}
+
+/**
+ * @brief Move constructor, taking over the other list's chain.
+ *
+ * @param other The list to move from; it is left empty.
+ */
+template <typename T>
+CompactList<T>::CompactList(CompactList&& other) noexcept : tail(std::exchange(other.tail, nullptr)) { }
+
+/**
+ * @brief Copy assignment operator, replacing the contents with a deep copy of another list.
+ *
+ * @param other The list to copy from.
+ * @return A reference to this list.
+ */
+template <typename T>
+CompactList<T>& CompactList<T>::operator=(const CompactList& other) {
+    if (this != &other) {
+        clear();
+        for (auto it = other.cbegin(); it != other.cend(); ++it) {
+            push_back(*it);
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Move assignment operator, taking over the other list's chain.
+ *
+ * @param other The list to move from; it is left empty.
+ * @return A reference to this list.
+ */
+template <typename T>
+CompactList<T>& CompactList<T>::operator=(CompactList&& other) noexcept {
+    if (this != &other) {
+        clear();
+        tail = std::exchange(other.tail, nullptr);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys the list and frees all nodes.
+ */
+template <typename T>
+CompactList<T>::~CompactList() {
+    clear();
+}
+
+/**
+ * @brief Accessor to the front element of the list.
+ *
+ * @return A reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename CompactList<T>::reference CompactList<T>::front() {
+    if (!tail) {
+        throw std::out_of_range("CompactList is empty");
+    }
+    return tail->next->data;
+}
+
+/**
+ * @brief Const accessor to the front element of the list.
+ *
+ * @return A const reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename CompactList<T>::const_reference CompactList<T>::front() const {
+    if (!tail) {
+        throw std::out_of_range("CompactList is empty");
+    }
+    return tail->next->data;
+}
+
+/**
+ * @brief Accessor to the back element of the list.
+ *
+ * @return A reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename CompactList<T>::reference CompactList<T>::back() {
+    if (!tail) {
+        throw std::out_of_range("CompactList is empty");
+    }
+    return tail->data;
+}
+
+/**
+ * @brief Const accessor to the back element of the list.
+ *
+ * @return A const reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename CompactList<T>::const_reference CompactList<T>::back() const {
+    if (!tail) {
+        throw std::out_of_range("CompactList is empty");
+    }
+    return tail->data;
+}
+
+/**
+ * @brief Adds an element to the back of the list in O(1).
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void CompactList<T>::push_back(const T& value) {
+    link_back(new Node(value));
+}
+
+/**
+ * @brief Adds an r-value element to the back of the list in O(1).
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void CompactList<T>::push_back(T&& value) {
+    link_back(new Node(std::move(value)));
+}
+
+/**
+ * @brief Adds an element to the front of the list in O(1).
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void CompactList<T>::push_front(const T& value) {
+    link_front(new Node(value));
+}
+
+/**
+ * @brief Adds an r-value element to the front of the list in O(1).
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void CompactList<T>::push_front(T&& value) {
+    link_front(new Node(std::move(value)));
+}
+
+/**
+ * @brief Constructs and appends a new element to the end of the list.
+ *
+ * @param args The arguments to construct the new element.
+ * @return A reference to the new element.
+ */
+template <typename T>
+template<typename... Args>
+typename CompactList<T>::reference CompactList<T>::emplace_back(Args&&... args) {
+    Node* node = new Node(std::forward<Args>(args)...);
+    link_back(node);
+    return node->data;
+}
+
+/**
+ * @brief Constructs and prepends a new element to the front of the list.
+ *
+ * @param args The arguments to construct the new element.
+ * @return A reference to the new element.
+ */
+template <typename T>
+template<typename... Args>
+typename CompactList<T>::reference CompactList<T>::emplace_front(Args&&... args) {
+    Node* node = new Node(std::forward<Args>(args)...);
+    link_front(node);
+    return node->data;
+}
+
+/**
+ * @brief Removes the first element from the list in O(1).
+ */
+template <typename T>
+void CompactList<T>::pop_front() {
+    if (!tail) {
+        return;
+    }
+    Node* first = tail->next;
+    if (first == tail) {
+        tail = nullptr;
+    }
+    else {
+        tail->next = first->next;
+    }
+    delete first;
+}
+
+/**
+ * @brief Inserts a copy of a value after the given position.
+ *
+ * @param pos An element position, or `before_begin()` to insert at the front; this works on an
+ *            empty list too.
+ * @param value The value to insert.
+ * @return An iterator to the inserted element.
+ */
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::insert_after(const_iterator pos, const T& value) {
+    return iterator(link_after(pos.node_ptr, new Node(value)), this);
+}
+
+/**
+ * @brief Inserts an r-value after the given position.
+ *
+ * @param pos An element position, or `before_begin()` to insert at the front.
+ * @param value The value to insert.
+ * @return An iterator to the inserted element.
+ */
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::insert_after(const_iterator pos, T&& value) {
+    return iterator(link_after(pos.node_ptr, new Node(std::move(value))), this);
+}
+
+/**
+ * @brief Removes the element following the given position.
+ *
+ * @param pos An element position, or `before_begin()` to remove the first element. Passing the
+ *            last element, or `before_begin()` of an empty list, does nothing.
+ * @return An iterator to the element after the removed one, or `end()`.
+ */
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::erase_after(const_iterator pos) {
+    Node* before = pos.node_ptr;
+    if (!before) {
+        pop_front();
+        return begin();
+    }
+    if (before == tail) {
+        return end();
+    }
+    Node* victim = before->next;
+    before->next = victim->next;
+    if (victim == tail) {
+        tail = before;
+        delete victim;
+        return end();
+    }
+    delete victim;
+    return iterator(before->next, this);
+}
+
+/**
+ * @brief Clears the list, deleting all nodes.
+ */
+template <typename T>
+void CompactList<T>::clear() noexcept {
+    if (!tail) {
+        return;
+    }
+    Node* current = tail->next;
+    tail->next = nullptr;
+    while (current) {
+        Node* next = current->next;
+        delete current;
+        current = next;
+    }
+    tail = nullptr;
+}
+
+/**
+ * @brief Swaps the contents of two lists in O(1).
+ *
+ * @param other The list to swap with.
+ */
+template <typename T>
+void CompactList<T>::swap(CompactList& other) noexcept {
+    std::swap(tail, other.tail);
+}
+
+/**
+ * @brief Returns the position before the first element, for `insert_after` and `erase_after`.
+ *
+ * The chain is circular with no header node, so this position has no node of its own and
+ * compares equal to `end()`; passed to `insert_after` or `erase_after` it means the front.
+ *
+ * @return The before-the-front iterator.
+ */
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::before_begin() {
+    return iterator(nullptr, this);
+}
+
+/**
+ * @brief Returns an iterator pointing to the first element in the list.
+ *
+ * @return An iterator to the head of the chain.
+ */
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::begin() {
+    return iterator(tail ? tail->next : nullptr, this);
+}
+
+/**
+ * @brief Returns an iterator pointing past the last element in the list.
+ *
+ * @return The end iterator.
+ */
+template <typename T>
+typename CompactList<T>::iterator CompactList<T>::end() {
+    return iterator(nullptr, this);
+}
+
+/**
+ * @brief Returns the constant position before the first element.
+ *
+ * @return The before-the-front constant iterator; it compares equal to `cend()`.
+ */
+template <typename T>
+typename CompactList<T>::const_iterator CompactList<T>::cbefore_begin() const {
+    return const_iterator(nullptr, this);
+}
+
+/**
+ * @brief Returns a constant iterator pointing to the first element in the list.
+ *
+ * @return A constant iterator to the head of the chain.
+ */
+template <typename T>
+typename CompactList<T>::const_iterator CompactList<T>::cbegin() const {
+    return const_iterator(tail ? tail->next : nullptr, this);
+}
+
+/**
+ * @brief Returns a constant iterator pointing past the last element in the list.
+ *
+ * @return The constant end iterator.
+ */
+template <typename T>
+typename CompactList<T>::const_iterator CompactList<T>::cend() const {
+    return const_iterator(nullptr, this);
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * The size is not stored, to keep the header at one pointer; it is recovered by walking the
+ * chain, which is O(n) but cheap for the tiny lists this container is meant for.
+ *
+ * @return The size of the list.
+ */
+template <typename T>
+typename CompactList<T>::size_type CompactList<T>::getSize() const {
+    size_type count = 0;
+    for (auto it = cbegin(); it != cend(); ++it) {
+        ++count;
+    }
+    return count;
+}
+
+/**
+ * @brief Checks whether the list is empty in O(1).
+ *
+ * @return `true` if the list is empty, `false` otherwise.
+ */
+template <typename T>
+bool CompactList<T>::empty() const {
+    return tail == nullptr;
+}
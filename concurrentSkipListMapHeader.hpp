@@ -0,0 +1,95 @@
+#ifndef CONCURRENT_SKIP_LIST_MAP_H
+#define CONCURRENT_SKIP_LIST_MAP_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+#include "epochReclaimerHeader.hpp"
+#include "nodePoolHeader.hpp"
+
+#ifndef CONCURRENT_SKIP_LIST_MAX_LEVEL
+#define CONCURRENT_SKIP_LIST_MAX_LEVEL 24
+#endif
+
+template <typename K, typename V, typename Compare = std::less<K>>
+class ConcurrentSkipListMap {
+private:
+    static constexpr unsigned max_level = CONCURRENT_SKIP_LIST_MAX_LEVEL;
+    using link = std::atomic<std::uintptr_t>;
+
+    struct Node {
+        K key;
+        V value;
+        std::atomic<int> claims;
+        unsigned height;
+        link* tower();
+        const link* tower() const;
+    };
+
+    static constexpr std::size_t tower_offset = (sizeof(Node) + alignof(link) - 1) / alignof(link) * alignof(link);
+    static constexpr std::size_t node_align = alignof(Node) > alignof(link) ? alignof(Node) : alignof(link);
+
+    mutable link head[max_level];
+    std::atomic<std::size_t> count;
+    [[no_unique_address]] Compare less;
+
+    static Node* pointer(std::uintptr_t);
+    static std::uintptr_t word(const Node*);
+    static bool marked(std::uintptr_t);
+
+    template<std::size_t Height>
+    static void* allocate_tower();
+
+    template<std::size_t Height>
+    static void deallocate_tower(void*) noexcept;
+
+    template<typename Key, typename Value>
+    static Node* make_node(Key&&, Value&&, unsigned);
+
+    static void destroy_node(Node*) noexcept;
+    static void reclaim(void*);
+    static unsigned random_height();
+
+    bool find(const K&, link**, Node**) const;
+    const Node* lower_bound(const K&) const;
+    void release(Node*);
+
+    template<typename Key, typename Value>
+    bool emplace(Key&&, Value&&);
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    ConcurrentSkipListMap();
+    explicit ConcurrentSkipListMap(Compare);
+    ConcurrentSkipListMap(const ConcurrentSkipListMap&) = delete;
+    ConcurrentSkipListMap& operator=(const ConcurrentSkipListMap&) = delete;
+    ~ConcurrentSkipListMap();
+
+    bool insert(const K&, const V&);
+    bool insert(K&&, V&&);
+    bool erase(const K&);
+    std::optional<V> find(const K&) const;
+    bool contains(const K&) const;
+
+    template<typename F>
+    void for_each(F&&) const;
+
+    template<typename F>
+    void for_each_in(const K&, const K&, F&&) const;
+
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "concurrentSkipListMapImplementation.tpp"
+
+#endif
@@ -0,0 +1,514 @@
+#include "concurrentSkipListMapHeader.hpp"
+
+/**
+ * @brief Returns the node's tower of next links, stored right after the node.
+ *
+ * @return The links, level 0 first.
+ */
+template <typename K, typename V, typename Compare>
+typename ConcurrentSkipListMap<K, V, Compare>::link* ConcurrentSkipListMap<K, V, Compare>::Node::tower() {
+    return std::launder(reinterpret_cast<link*>(reinterpret_cast<unsigned char*>(this) + tower_offset));
+}
+
+/**
+ * @brief Returns the node's tower of next links, stored right after the node.
+ *
+ * @return The links, level 0 first.
+ */
+template <typename K, typename V, typename Compare>
+const typename ConcurrentSkipListMap<K, V, Compare>::link* ConcurrentSkipListMap<K, V, Compare>::Node::tower() const {
+    return std::launder(reinterpret_cast<const link*>(reinterpret_cast<const unsigned char*>(this) + tower_offset));
+}
+
+/**
+ * @brief Strips the deletion mark from a link.
+ *
+ * @param value The link's contents.
+ * @return The node it points to, or nullptr.
+ */
+template <typename K, typename V, typename Compare>
+typename ConcurrentSkipListMap<K, V, Compare>::Node* ConcurrentSkipListMap<K, V, Compare>::pointer(std::uintptr_t value) {
+    return reinterpret_cast<Node*>(value & ~std::uintptr_t(1));
+}
+
+/**
+ * @brief Converts a node pointer to unmarked link contents.
+ *
+ * @param node The node, or nullptr.
+ * @return The link contents.
+ */
+template <typename K, typename V, typename Compare>
+std::uintptr_t ConcurrentSkipListMap<K, V, Compare>::word(const Node* node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+}
+
+/**
+ * @brief Checks whether a link carries the deletion mark of the node that owns it.
+ *
+ * @param value The link's contents.
+ * @return True if the owning node is logically deleted at that level.
+ */
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::marked(std::uintptr_t value) {
+    return value & 1;
+}
+
+/**
+ * @brief Allocates a node with a tower of `Height` links from the slab pool for that size.
+ *
+ * @tparam Height The tower height.
+ * @return Storage for the node.
+ */
+template <typename K, typename V, typename Compare>
+template <std::size_t Height>
+void* ConcurrentSkipListMap<K, V, Compare>::allocate_tower() {
+    return NodePool<tower_offset + Height * sizeof(link), node_align>::instance().allocate();
+}
+
+/**
+ * @brief Returns a node with a tower of `Height` links to its slab pool.
+ *
+ * @tparam Height The tower height.
+ * @param ptr The node storage.
+ */
+template <typename K, typename V, typename Compare>
+template <std::size_t Height>
+void ConcurrentSkipListMap<K, V, Compare>::deallocate_tower(void* ptr) noexcept {
+    NodePool<tower_offset + Height * sizeof(link), node_align>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Allocates and constructs an unlinked node.
+ *
+ * The node starts with two claims, one held by its inserter until the tower is built and one
+ * released by whoever erases it; the node is retired when both are gone.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @param height The number of levels the node is linked into.
+ * @return The new node, with all links null.
+ */
+template <typename K, typename V, typename Compare>
+template <typename Key, typename Value>
+typename ConcurrentSkipListMap<K, V, Compare>::Node* ConcurrentSkipListMap<K, V, Compare>::make_node(Key&& key, Value&& value, unsigned height) {
+    static constexpr auto allocators = []<std::size_t... H>(std::index_sequence<H...>) {
+        return std::array<void* (*)(), sizeof...(H)>{&allocate_tower<H + 1>...};
+    }(std::make_index_sequence<max_level>{});
+    static constexpr auto deallocators = []<std::size_t... H>(std::index_sequence<H...>) {
+        return std::array<void (*)(void*) noexcept, sizeof...(H)>{&deallocate_tower<H + 1>...};
+    }(std::make_index_sequence<max_level>{});
+
+    void* storage = allocators[height - 1]();
+    Node* node;
+    try {
+        node = ::new (storage) Node{K(std::forward<Key>(key)), V(std::forward<Value>(value)), {2}, height};
+    }
+    catch (...) {
+        deallocators[height - 1](storage);
+        throw;
+    }
+    for (unsigned level = 0; level < height; ++level) {
+        ::new (static_cast<void*>(node->tower() + level)) link(0);
+    }
+    return node;
+}
+
+/**
+ * @brief Destroys a node and returns it to the pool for its height.
+ *
+ * @param node The node to free; it must be unreachable.
+ */
+template <typename K, typename V, typename Compare>
+void ConcurrentSkipListMap<K, V, Compare>::destroy_node(Node* node) noexcept {
+    static constexpr auto deallocators = []<std::size_t... H>(std::index_sequence<H...>) {
+        return std::array<void (*)(void*) noexcept, sizeof...(H)>{&deallocate_tower<H + 1>...};
+    }(std::make_index_sequence<max_level>{});
+
+    unsigned height = node->height;
+    std::destroy_at(node);
+    deallocators[height - 1](node);
+}
+
+/**
+ * @brief Frees a node retired through `EpochReclaimer`.
+ *
+ * @param node The node to free.
+ */
+template <typename K, typename V, typename Compare>
+void ConcurrentSkipListMap<K, V, Compare>::reclaim(void* node) {
+    destroy_node(static_cast<Node*>(node));
+}
+
+/**
+ * @brief Draws a tower height with P(height > h) = 2^-h, capped at `CONCURRENT_SKIP_LIST_MAX_LEVEL`.
+ *
+ * Each thread uses its own xorshift generator, so concurrent inserts do not contend on it.
+ *
+ * @return The height, at least 1.
+ */
+template <typename K, typename V, typename Compare>
+unsigned ConcurrentSkipListMap<K, V, Compare>::random_height() {
+    thread_local std::uint64_t state = 0;
+    if (state == 0) {
+        state = reinterpret_cast<std::uintptr_t>(&state) * 0x9e3779b97f4a7c15ULL | 1;
+    }
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    unsigned height = 1;
+    for (std::uint64_t bits = state; (bits & 1) && height < max_level; bits >>= 1) {
+        ++height;
+    }
+    return height;
+}
+
+/**
+ * @brief Locates the position of a key at every level, unlinking logically deleted nodes on the way.
+ *
+ * A node whose link at some level carries the deletion mark is cut out of that level by swinging
+ * its predecessor's link past it. If that fails because the predecessor changed or was itself
+ * deleted, the search restarts from the top.
+ *
+ * @param key The key to look for.
+ * @param preds Receives, per level, the link that points at the first node not less than `key`; may be nullptr.
+ * @param succs Receives, per level, the first node not less than `key`; may be nullptr.
+ * @return True if a live node with `key` is linked at level 0.
+ */
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::find(const K& key, link** preds, Node** succs) const {
+retry:
+    link* pred = head;
+    Node* curr = nullptr;
+    for (int level = static_cast<int>(max_level) - 1; level >= 0; --level) {
+        curr = pointer(pred[level].load(std::memory_order_acquire));
+        while (curr) {
+            std::uintptr_t succ = curr->tower()[level].load(std::memory_order_acquire);
+            while (marked(succ)) {
+                std::uintptr_t expected = word(curr);
+                if (!pred[level].compare_exchange_strong(expected, succ & ~std::uintptr_t(1),
+                                                         std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    goto retry;
+                }
+                curr = pointer(succ);
+                if (!curr) {
+                    break;
+                }
+                succ = curr->tower()[level].load(std::memory_order_acquire);
+            }
+            if (!curr || !less(curr->key, key)) {
+                break;
+            }
+            pred = curr->tower();
+            curr = pointer(succ);
+        }
+        if (preds) {
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+    }
+    return curr && !less(key, curr->key);
+}
+
+/**
+ * @brief Finds the first live node not less than a key without modifying any link.
+ *
+ * Logically deleted nodes are stepped over rather than unlinked, so readers never write to
+ * shared memory.
+ *
+ * @param key The key to look for.
+ * @return The node, or nullptr if every key is less than `key`.
+ */
+template <typename K, typename V, typename Compare>
+const typename ConcurrentSkipListMap<K, V, Compare>::Node* ConcurrentSkipListMap<K, V, Compare>::lower_bound(const K& key) const {
+    const link* pred = head;
+    const Node* curr = nullptr;
+    for (int level = static_cast<int>(max_level) - 1; level >= 0; --level) {
+        curr = pointer(pred[level].load(std::memory_order_acquire));
+        while (curr) {
+            std::uintptr_t succ = curr->tower()[level].load(std::memory_order_acquire);
+            if (marked(succ)) {
+                curr = pointer(succ);
+                continue;
+            }
+            if (!less(curr->key, key)) {
+                break;
+            }
+            pred = curr->tower();
+            curr = pointer(succ);
+        }
+    }
+    return curr;
+}
+
+/**
+ * @brief Drops one claim on a node, retiring it when none is left.
+ *
+ * The last claim runs one more search for the node's key so that it is unlinked from every
+ * level it reached, including levels its inserter linked after the eraser's own search.
+ *
+ * @param node The node.
+ */
+template <typename K, typename V, typename Compare>
+void ConcurrentSkipListMap<K, V, Compare>::release(Node* node) {
+    if (node->claims.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        find(node->key, nullptr, nullptr);
+        EpochReclaimer::retire(node, &reclaim);
+    }
+}
+
+/**
+ * @brief Constructs an empty map.
+ */
+template <typename K, typename V, typename Compare>
+ConcurrentSkipListMap<K, V, Compare>::ConcurrentSkipListMap() : ConcurrentSkipListMap(Compare()) { }
+
+/**
+ * @brief Constructs an empty map with a custom ordering.
+ *
+ * @param compare The strict weak ordering of keys.
+ */
+template <typename K, typename V, typename Compare>
+ConcurrentSkipListMap<K, V, Compare>::ConcurrentSkipListMap(Compare compare) : count(0), less(std::move(compare)) {
+    for (link& level : head) {
+        level.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Destroys every node still linked at level 0.
+ *
+ * Must not run concurrently with any other operation on the map. Nodes already retired are
+ * freed by `EpochReclaimer`.
+ */
+template <typename K, typename V, typename Compare>
+ConcurrentSkipListMap<K, V, Compare>::~ConcurrentSkipListMap() {
+    Node* node = pointer(head[0].load(std::memory_order_acquire));
+    while (node) {
+        Node* next = pointer(node->tower()[0].load(std::memory_order_relaxed));
+        destroy_node(node);
+        node = next;
+    }
+}
+
+/**
+ * @brief Links a new node for a key that is not present yet.
+ *
+ * The node becomes visible when it is linked at level 0, which is the insertion's linearization
+ * point; the upper levels are then linked bottom-up. If the node is erased while its tower is
+ * being built, the remaining levels are abandoned.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the key was inserted, false if it was already present.
+ */
+template <typename K, typename V, typename Compare>
+template <typename Key, typename Value>
+bool ConcurrentSkipListMap<K, V, Compare>::emplace(Key&& key, Value&& value) {
+    EpochReclaimer::Guard guard;
+    link* preds[max_level];
+    Node* succs[max_level];
+    Node* node = nullptr;
+    unsigned height = 0;
+    for (;;) {
+        if (find(node ? node->key : key, preds, succs)) {
+            if (node) {
+                destroy_node(node);
+            }
+            return false;
+        }
+        if (!node) {
+            height = random_height();
+            node = make_node(std::forward<Key>(key), std::forward<Value>(value), height);
+        }
+        for (unsigned level = 0; level < height; ++level) {
+            node->tower()[level].store(word(succs[level]), std::memory_order_relaxed);
+        }
+        std::uintptr_t expected = word(succs[0]);
+        if (preds[0][0].compare_exchange_strong(expected, word(node), std::memory_order_release, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    count.fetch_add(1, std::memory_order_relaxed);
+
+    for (unsigned level = 1; level < height; ++level) {
+        for (;;) {
+            std::uintptr_t current = node->tower()[level].load(std::memory_order_acquire);
+            if (marked(current)) {
+                release(node);
+                return true;
+            }
+            if (current != word(succs[level]) &&
+                !node->tower()[level].compare_exchange_strong(current, word(succs[level]), std::memory_order_release, std::memory_order_relaxed)) {
+                continue;
+            }
+            std::uintptr_t expected = word(succs[level]);
+            if (preds[level][level].compare_exchange_strong(expected, word(node), std::memory_order_release, std::memory_order_relaxed)) {
+                break;
+            }
+            find(node->key, preds, succs);
+            if (succs[0] != node) {
+                release(node);
+                return true;
+            }
+        }
+    }
+    release(node);
+    return true;
+}
+
+/**
+ * @brief Inserts a copy of a key and value if the key is not present.
+ *
+ * Lock-free; safe to call concurrently with every other operation.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the pair was inserted, false if the key was already present.
+ */
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::insert(const K& key, const V& value) {
+    return emplace(key, value);
+}
+
+/**
+ * @brief Moves a key and value into the map if the key is not present.
+ *
+ * Lock-free; safe to call concurrently with every other operation.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the pair was inserted, false if the key was already present.
+ */
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::insert(K&& key, V&& value) {
+    return emplace(std::move(key), std::move(value));
+}
+
+/**
+ * @brief Removes a key.
+ *
+ * The node's links are marked from the top level down; marking the level 0 link is the
+ * linearization point, and the thread that does it owns the removal. It then searches for the
+ * key once to unlink the node everywhere and drops its claim.
+ *
+ * Lock-free; safe to call concurrently with every other operation.
+ *
+ * @param key The key to remove.
+ * @return True if this call removed the key, false if it was not present.
+ */
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::erase(const K& key) {
+    EpochReclaimer::Guard guard;
+    link* preds[max_level];
+    Node* succs[max_level];
+    if (!find(key, preds, succs)) {
+        return false;
+    }
+    Node* victim = succs[0];
+    for (unsigned level = victim->height - 1; level > 0; --level) {
+        victim->tower()[level].fetch_or(1, std::memory_order_acq_rel);
+    }
+    if (marked(victim->tower()[0].fetch_or(1, std::memory_order_acq_rel))) {
+        return false;
+    }
+    count.fetch_sub(1, std::memory_order_relaxed);
+    find(key, nullptr, nullptr);
+    release(victim);
+    return true;
+}
+
+/**
+ * @brief Looks up a key.
+ *
+ * Wait-free apart from the descent itself: no link is written.
+ *
+ * @param key The key to look for.
+ * @return A copy of the value, or an empty optional if the key is not present.
+ */
+template <typename K, typename V, typename Compare>
+std::optional<V> ConcurrentSkipListMap<K, V, Compare>::find(const K& key) const {
+    EpochReclaimer::Guard guard;
+    const Node* node = lower_bound(key);
+    if (node && !less(key, node->key)) {
+        return node->value;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Checks whether a key is present.
+ *
+ * @param key The key to look for.
+ * @return True if the key is present.
+ */
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::contains(const K& key) const {
+    EpochReclaimer::Guard guard;
+    const Node* node = lower_bound(key);
+    return node && !less(key, node->key);
+}
+
+/**
+ * @brief Calls a function on every pair in key order.
+ *
+ * The scan is weakly consistent: it sees every pair present for its whole duration, may or may
+ * not see pairs inserted or erased while it runs, and never sees a key twice.
+ *
+ * @param fn Callable as `fn(const K&, const V&)`.
+ */
+template <typename K, typename V, typename Compare>
+template <typename F>
+void ConcurrentSkipListMap<K, V, Compare>::for_each(F&& fn) const {
+    EpochReclaimer::Guard guard;
+    for (const Node* node = pointer(head[0].load(std::memory_order_acquire)); node;) {
+        std::uintptr_t next = node->tower()[0].load(std::memory_order_acquire);
+        if (!marked(next)) {
+            fn(node->key, node->value);
+        }
+        node = pointer(next);
+    }
+}
+
+/**
+ * @brief Calls a function on every pair with a key in `[first, last)`, in key order.
+ *
+ * Weakly consistent, like `for_each`.
+ *
+ * @param first The smallest key to visit.
+ * @param last The key to stop before.
+ * @param fn Callable as `fn(const K&, const V&)`.
+ */
+template <typename K, typename V, typename Compare>
+template <typename F>
+void ConcurrentSkipListMap<K, V, Compare>::for_each_in(const K& first, const K& last, F&& fn) const {
+    EpochReclaimer::Guard guard;
+    for (const Node* node = lower_bound(first); node && less(node->key, last);) {
+        std::uintptr_t next = node->tower()[0].load(std::memory_order_acquire);
+        if (!marked(next)) {
+            fn(node->key, node->value);
+        }
+        node = pointer(next);
+    }
+}
+
+/**
+ * @brief Returns the number of pairs in the map.
+ *
+ * With concurrent inserts and erases the result is only a snapshot.
+ *
+ * @return The approximate number of pairs.
+ */
+template <typename K, typename V, typename Compare>
+typename ConcurrentSkipListMap<K, V, Compare>::size_type ConcurrentSkipListMap<K, V, Compare>::getSize() const {
+    return count.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Checks whether the map is empty.
+ *
+ * @return True if the map held no pairs when checked.
+ */
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::empty() const {
+    return getSize() == 0;
+}
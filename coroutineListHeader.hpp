@@ -0,0 +1,148 @@
+#ifndef COROUTINE_LIST_H
+#define COROUTINE_LIST_H
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "listHeader.hpp"
+
+template <typename T>
+class ListGenerator {
+public:
+    using value_type = std::remove_cvref_t<T>;
+    using reference = std::add_lvalue_reference_t<T>;
+    using pointer = std::add_pointer_t<std::remove_reference_t<T>>;
+
+    class promise_type {
+    public:
+        ListGenerator get_return_object();
+        std::suspend_always initial_suspend() noexcept;
+        std::suspend_always final_suspend() noexcept;
+        std::suspend_always yield_value(reference);
+        std::suspend_always yield_value(value_type&&) requires (!std::is_reference_v<T> && !std::is_const_v<T>);
+        void return_void() noexcept;
+        void unhandled_exception();
+        template<typename U>
+        std::suspend_never await_transform(U&&) = delete;
+        friend class ListGenerator;
+    private:
+        pointer current = nullptr;
+        std::optional<value_type> slot;
+        std::exception_ptr exception;
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    struct sentinel { };
+
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename ListGenerator::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename ListGenerator::pointer;
+        using reference = typename ListGenerator::reference;
+
+        iterator() = default;
+        explicit iterator(handle_type);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        void operator++(int);
+        bool operator==(sentinel) const;
+    private:
+        handle_type coroutine = nullptr;
+    };
+
+    ListGenerator() = default;
+    explicit ListGenerator(handle_type);
+    ListGenerator(ListGenerator&&) noexcept;
+    ListGenerator& operator=(ListGenerator&&) noexcept;
+    ListGenerator(const ListGenerator&) = delete;
+    ListGenerator& operator=(const ListGenerator&) = delete;
+    ~ListGenerator();
+
+    iterator begin();
+    sentinel end() const noexcept;
+
+private:
+    handle_type coroutine = nullptr;
+};
+
+template <typename T>
+ListGenerator<T&> as_generator(List<T>&);
+
+template <typename T>
+ListGenerator<const T&> as_generator(const List<T>&);
+
+template <typename T>
+ListGenerator<T&> as_generator(List<T>&, typename List<T>::iterator, typename List<T>::iterator);
+
+template <typename T>
+class AsyncList {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using executor_type = std::function<void(std::coroutine_handle<>)>;
+
+    class pop_awaiter {
+    public:
+        explicit pop_awaiter(AsyncList&);
+        ~pop_awaiter();
+        bool await_ready() const noexcept;
+        bool await_suspend(std::coroutine_handle<>);
+        std::optional<T> await_resume();
+        friend class AsyncList<T>;
+    private:
+        AsyncList& channel;
+        std::coroutine_handle<> handle;
+        std::optional<T> result;
+        std::atomic<bool> queued;
+    };
+
+    AsyncList();
+    explicit AsyncList(executor_type);
+    AsyncList(const AsyncList&) = delete;
+    AsyncList& operator=(const AsyncList&) = delete;
+    ~AsyncList();
+
+    void push(const T&);
+    void push(T&&);
+
+    template<typename... Args>
+    void emplace(Args&&...);
+
+    template<std::ranges::range R>
+    void push_range(R&&);
+
+    pop_awaiter pop();
+    std::optional<T> try_pop();
+    void close();
+    bool closed() const;
+    size_type getSize() const;
+    size_type waiting() const;
+
+private:
+    List<T> items;
+    List<pop_awaiter*> waiters;
+    executor_type executor;
+    mutable std::mutex mutex;
+    bool is_closed;
+
+    void resume_all(List<std::coroutine_handle<>>&);
+
+    template<typename... Args>
+    void hand_off(List<std::coroutine_handle<>>&, Args&&...);
+};
+
+#include "coroutineListImplementation.tpp"
+
+#endif
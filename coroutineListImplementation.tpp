@@ -0,0 +1,559 @@
+#include "coroutineListHeader.hpp"
+
+/**
+ * @brief Creates the generator object owning the coroutine frame of this promise.
+ *
+ * @return A generator that resumes this coroutine on demand.
+ */
+template <typename T>
+ListGenerator<T> ListGenerator<T>::promise_type::get_return_object() {
+    return ListGenerator<T>(handle_type::from_promise(*this));
+}
+
+/**
+ * @brief Suspends the coroutine before its body runs.
+ *
+ * Generators are lazy: nothing is produced until the first call to `begin()`.
+ *
+ * @return An awaiter that always suspends.
+ */
+template <typename T>
+std::suspend_always ListGenerator<T>::promise_type::initial_suspend() noexcept {
+    return {};
+}
+
+/**
+ * @brief Suspends the coroutine after its body finishes so the generator can observe completion.
+ *
+ * @return An awaiter that always suspends.
+ */
+template <typename T>
+std::suspend_always ListGenerator<T>::promise_type::final_suspend() noexcept {
+    return {};
+}
+
+/**
+ * @brief Publishes an lvalue produced by `co_yield` without copying it.
+ *
+ * The referenced object lives in the suspended coroutine frame (or in the list being viewed),
+ * so it stays valid until the generator is resumed again.
+ *
+ * @param value The yielded element.
+ * @return An awaiter that always suspends.
+ */
+template <typename T>
+std::suspend_always ListGenerator<T>::promise_type::yield_value(reference value) {
+    current = std::addressof(value);
+    return {};
+}
+
+/**
+ * @brief Publishes a temporary produced by `co_yield` by moving it into the promise.
+ *
+ * @param value The yielded temporary.
+ * @return An awaiter that always suspends.
+ */
+template <typename T>
+std::suspend_always ListGenerator<T>::promise_type::yield_value(value_type&& value) requires (!std::is_reference_v<T> && !std::is_const_v<T>) {
+    slot.emplace(std::move(value));
+    current = std::addressof(*slot);
+    return {};
+}
+
+/**
+ * @brief Marks the end of the generated sequence.
+ */
+template <typename T>
+void ListGenerator<T>::promise_type::return_void() noexcept {
+    current = nullptr;
+}
+
+/**
+ * @brief Captures an exception escaping the coroutine body so it can be rethrown to the consumer.
+ */
+template <typename T>
+void ListGenerator<T>::promise_type::unhandled_exception() {
+    exception = std::current_exception();
+}
+
+/**
+ * @brief Constructs a generator iterator bound to a coroutine.
+ *
+ * @param handle The coroutine to pull values from.
+ */
+template <typename T>
+ListGenerator<T>::iterator::iterator(handle_type handle) : coroutine(handle) { }
+
+/**
+ * @brief Dereference operator for the generator iterator.
+ *
+ * @return A reference to the most recently yielded value.
+ */
+template <typename T>
+typename ListGenerator<T>::iterator::reference ListGenerator<T>::iterator::operator*() const {
+    return *coroutine.promise().current;
+}
+
+/**
+ * @brief Arrow operator for the generator iterator.
+ *
+ * @return A pointer to the most recently yielded value.
+ */
+template <typename T>
+typename ListGenerator<T>::iterator::pointer ListGenerator<T>::iterator::operator->() const {
+    return coroutine.promise().current;
+}
+
+/**
+ * @brief Resumes the coroutine until it yields the next value or finishes.
+ *
+ * @return A reference to the updated iterator.
+ * @throw Any exception thrown by the coroutine body.
+ */
+template <typename T>
+typename ListGenerator<T>::iterator& ListGenerator<T>::iterator::operator++() {
+    coroutine.resume();
+    if (coroutine.promise().exception) {
+        std::rethrow_exception(coroutine.promise().exception);
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment for the generator iterator.
+ *
+ * Input iterators cannot return their previous state, so this simply advances.
+ */
+template <typename T>
+void ListGenerator<T>::iterator::operator++(int) {
+    ++*this;
+}
+
+/**
+ * @brief Checks whether the coroutine has run to completion.
+ *
+ * @return true once the generator has no more values.
+ */
+template <typename T>
+bool ListGenerator<T>::iterator::operator==(sentinel) const {
+    return !coroutine || coroutine.done();
+}
+
+/**
+ * @brief Constructs a generator taking ownership of a coroutine frame.
+ *
+ * @param handle The coroutine handle to own.
+ */
+template <typename T>
+ListGenerator<T>::ListGenerator(handle_type handle) : coroutine(handle) { }
+
+/**
+ * @brief Move constructor, transferring ownership of the coroutine frame.
+ *
+ * @param other The generator to move from.
+ */
+template <typename T>
+ListGenerator<T>::ListGenerator(ListGenerator&& other) noexcept : coroutine(std::exchange(other.coroutine, nullptr)) { }
+
+/**
+ * @brief Move assignment, destroying the current frame and taking over the other's.
+ *
+ * @param other The generator to move from.
+ * @return A reference to this generator.
+ */
+template <typename T>
+ListGenerator<T>& ListGenerator<T>::operator=(ListGenerator&& other) noexcept {
+    if (this != &other) {
+        if (coroutine) {
+            coroutine.destroy();
+        }
+        coroutine = std::exchange(other.coroutine, nullptr);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys the coroutine frame, if any.
+ */
+template <typename T>
+ListGenerator<T>::~ListGenerator() {
+    if (coroutine) {
+        coroutine.destroy();
+    }
+}
+
+/**
+ * @brief Starts the coroutine and returns an iterator to its first value.
+ *
+ * @return An iterator to the first generated value, or one equal to `end()` if there is none.
+ * @throw Any exception thrown by the coroutine body before its first yield.
+ */
+template <typename T>
+typename ListGenerator<T>::iterator ListGenerator<T>::begin() {
+    if (coroutine) {
+        coroutine.resume();
+        if (coroutine.promise().exception) {
+            std::rethrow_exception(coroutine.promise().exception);
+        }
+    }
+    return iterator(coroutine);
+}
+
+/**
+ * @brief Returns the sentinel marking the end of the generated sequence.
+ *
+ * @return The end sentinel.
+ */
+template <typename T>
+typename ListGenerator<T>::sentinel ListGenerator<T>::end() const noexcept {
+    return {};
+}
+
+/**
+ * @brief Creates a lazy coroutine view yielding references to every element of a list.
+ *
+ * The list must outlive the generator and must not have the current element erased while suspended.
+ *
+ * @param list The list to view.
+ * @return A generator yielding `T&` in list order.
+ */
+template <typename T>
+ListGenerator<T&> as_generator(List<T>& list) {
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        co_yield *it;
+    }
+}
+
+/**
+ * @brief Creates a lazy read-only coroutine view over every element of a list.
+ *
+ * @param list The list to view.
+ * @return A generator yielding `const T&` in list order.
+ */
+template <typename T>
+ListGenerator<const T&> as_generator(const List<T>& list) {
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+        co_yield *it;
+    }
+}
+
+/**
+ * @brief Creates a lazy coroutine view over the sub-range `[first, last)` of a list.
+ *
+ * @param list The list the iterators belong to.
+ * @param first The first element to yield.
+ * @param last One past the last element to yield.
+ * @return A generator yielding `T&` in list order.
+ */
+template <typename T>
+ListGenerator<T&> as_generator(List<T>&, typename List<T>::iterator first, typename List<T>::iterator last) {
+    for (; first != last; ++first) {
+        co_yield *first;
+    }
+}
+
+/**
+ * @brief Constructs the awaiter returned by `AsyncList::pop()`.
+ *
+ * @param owner The channel to pop from.
+ */
+template <typename T>
+AsyncList<T>::pop_awaiter::pop_awaiter(AsyncList& owner) : channel(owner), handle(nullptr), queued(false) { }
+
+/**
+ * @brief Leaves the waiter queue if the awaiting coroutine is destroyed while still suspended.
+ *
+ * Without this, destroying a parked consumer (for example when its task is cancelled) would leave
+ * a dangling entry that the next push or `close()` resumes. Awaiters that are not queued never
+ * touch the channel, which may already be gone by the time a resumed consumer finishes. A consumer
+ * that has been handed a value is no longer queued and is resumed by the producer, so it must not
+ * be destroyed until that resumption has happened.
+ */
+template <typename T>
+AsyncList<T>::pop_awaiter::~pop_awaiter() {
+    if (!queued.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(channel.mutex);
+    if (queued.load(std::memory_order_relaxed)) {
+        channel.waiters.remove(this);
+    }
+}
+
+/**
+ * @brief Always defers to `await_suspend`, which checks for a value under the channel lock.
+ *
+ * @return false.
+ */
+template <typename T>
+bool AsyncList<T>::pop_awaiter::await_ready() const noexcept {
+    return false;
+}
+
+/**
+ * @brief Takes a queued value immediately or parks the awaiting coroutine.
+ *
+ * If the channel has a value, or is closed, the coroutine continues without suspending.
+ * Otherwise the awaiter is appended to the waiter queue and the coroutine stays suspended
+ * until a producer hands it a value.
+ *
+ * @param awaiting The coroutine executing `co_await`.
+ * @return true if the coroutine was suspended, false if it should continue immediately.
+ */
+template <typename T>
+bool AsyncList<T>::pop_awaiter::await_suspend(std::coroutine_handle<> awaiting) {
+    std::lock_guard<std::mutex> lock(channel.mutex);
+    if (!channel.items.empty()) {
+        result.emplace(std::move(channel.items.front()));
+        channel.items.pop_front();
+        return false;
+    }
+    if (channel.is_closed) {
+        return false;
+    }
+    handle = awaiting;
+    channel.waiters.push_back(this);
+    queued.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Produces the result of `co_await channel.pop()`.
+ *
+ * @return The popped value, or `std::nullopt` if the channel was closed and drained.
+ */
+template <typename T>
+std::optional<T> AsyncList<T>::pop_awaiter::await_resume() {
+    return std::move(result);
+}
+
+/**
+ * @brief Constructs an open channel that resumes consumers inline on the producer's thread.
+ */
+template <typename T>
+AsyncList<T>::AsyncList() : executor(nullptr), is_closed(false) { }
+
+/**
+ * @brief Constructs an open channel that resumes consumers through the given executor.
+ *
+ * The executor is invoked on the producer's thread, after the channel lock has been released,
+ * once for every consumer woken by a push.
+ *
+ * @param exec The callable used to schedule resumed consumers.
+ */
+template <typename T>
+AsyncList<T>::AsyncList(executor_type exec) : executor(std::move(exec)), is_closed(false) { }
+
+/**
+ * @brief Destroys the channel, waking any still-suspended consumers with `std::nullopt`.
+ */
+template <typename T>
+AsyncList<T>::~AsyncList() {
+    close();
+}
+
+/**
+ * @brief Pushes a copy of a value, waking one suspended consumer if any.
+ *
+ * @param value The value to push.
+ */
+template <typename T>
+void AsyncList<T>::push(const T& value) {
+    emplace(value);
+}
+
+/**
+ * @brief Pushes an r-value, waking one suspended consumer if any.
+ *
+ * @param value The value to push.
+ */
+template <typename T>
+void AsyncList<T>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+/**
+ * @brief Gives a value straight to the longest-waiting consumer; the lock must be held.
+ *
+ * The value is constructed in the consumer's result slot before the consumer leaves the wait
+ * queue, so if the constructor throws the consumer stays queued for the next value instead of
+ * being dropped without ever being resumed.
+ *
+ * @param ready Receives the consumer's handle, to be resumed once the lock is released.
+ * @param args The arguments to construct the value from.
+ */
+template <typename T>
+template<typename... Args>
+void AsyncList<T>::hand_off(List<std::coroutine_handle<>>& ready, Args&&... args) {
+    pop_awaiter* waiter = waiters.front();
+    waiter->result.emplace(std::forward<Args>(args)...);
+    try {
+        ready.push_back(waiter->handle);
+    }
+    catch (...) {
+        waiter->result.reset();
+        throw;
+    }
+    waiter->queued.store(false, std::memory_order_release);
+    waiters.pop_front();
+}
+
+/**
+ * @brief Constructs a value in the channel, handing it directly to a waiting consumer when possible.
+ *
+ * A waiting consumer receives the value without it ever being linked into the queue.
+ * The consumer is resumed after the lock is released.
+ *
+ * @param args The arguments to construct the value from.
+ * @throw std::logic_error if the channel is closed.
+ */
+template <typename T>
+template<typename... Args>
+void AsyncList<T>::emplace(Args&&... args) {
+    List<std::coroutine_handle<>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (is_closed) {
+            throw std::logic_error("AsyncList is closed");
+        }
+        if (waiters.empty()) {
+            items.emplace_back(std::forward<Args>(args)...);
+            return;
+        }
+        hand_off(ready, std::forward<Args>(args)...);
+    }
+    resume_all(ready);
+}
+
+/**
+ * @brief Pushes every element of a range as one batch.
+ *
+ * The whole range is distributed under a single lock acquisition: waiting consumers receive
+ * values first and the remainder is queued. All woken consumers are then resumed together
+ * once the lock has been released.
+ *
+ * @param rg The range of values to push.
+ * @throw std::logic_error if the channel is closed.
+ */
+template <typename T>
+template<std::ranges::range R>
+void AsyncList<T>::push_range(R&& rg) {
+    List<std::coroutine_handle<>> ready;
+    try {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (is_closed) {
+            throw std::logic_error("AsyncList is closed");
+        }
+        for (auto&& elem : rg) {
+            if (waiters.empty()) {
+                items.emplace_back(std::forward<decltype(elem)>(elem));
+                continue;
+            }
+            hand_off(ready, std::forward<decltype(elem)>(elem));
+        }
+    }
+    catch (...) {
+        resume_all(ready);
+        throw;
+    }
+    resume_all(ready);
+}
+
+/**
+ * @brief Returns an awaitable that yields the next value, suspending while the channel is empty.
+ *
+ * @return An awaiter producing `std::optional<T>`; `std::nullopt` means the channel is closed and drained.
+ */
+template <typename T>
+typename AsyncList<T>::pop_awaiter AsyncList<T>::pop() {
+    return pop_awaiter(*this);
+}
+
+/**
+ * @brief Pops a value without suspending.
+ *
+ * @return The front value, or `std::nullopt` if the channel is currently empty.
+ */
+template <typename T>
+std::optional<T> AsyncList<T>::try_pop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (items.empty()) {
+        return std::nullopt;
+    }
+    std::optional<T> value(std::move(items.front()));
+    items.pop_front();
+    return value;
+}
+
+/**
+ * @brief Closes the channel.
+ *
+ * Further pushes throw. Queued values can still be popped; every consumer currently suspended
+ * is resumed with `std::nullopt`.
+ */
+template <typename T>
+void AsyncList<T>::close() {
+    List<std::coroutine_handle<>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        is_closed = true;
+        while (!waiters.empty()) {
+            ready.push_back(waiters.front()->handle);
+            waiters.front()->queued.store(false, std::memory_order_release);
+            waiters.pop_front();
+        }
+    }
+    resume_all(ready);
+}
+
+/**
+ * @brief Checks whether the channel has been closed.
+ *
+ * @return true if `close()` has been called.
+ */
+template <typename T>
+bool AsyncList<T>::closed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return is_closed;
+}
+
+/**
+ * @brief Returns the number of queued values not yet taken by a consumer.
+ *
+ * @return The number of queued values.
+ */
+template <typename T>
+typename AsyncList<T>::size_type AsyncList<T>::getSize() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return items.getSize();
+}
+
+/**
+ * @brief Returns the number of consumers currently suspended in `pop()`.
+ *
+ * @return The number of suspended consumers.
+ */
+template <typename T>
+typename AsyncList<T>::size_type AsyncList<T>::waiting() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return waiters.getSize();
+}
+
+/**
+ * @brief Resumes a batch of woken consumers, inline or through the executor.
+ *
+ * Must be called without holding the channel lock, since resumed consumers may push or pop.
+ *
+ * @param ready The handles of the consumers to resume.
+ */
+template <typename T>
+void AsyncList<T>::resume_all(List<std::coroutine_handle<>>& ready) {
+    for (auto it = ready.begin(); it != ready.end(); ++it) {
+        if (executor) {
+            executor(*it);
+        }
+        else {
+            it->resume();
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef EPOCH_RECLAIMER_H
+#define EPOCH_RECLAIMER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#ifndef EPOCH_RECLAIMER_COLLECT_INTERVAL
+#define EPOCH_RECLAIMER_COLLECT_INTERVAL 64
+#endif
+
+class EpochReclaimer {
+public:
+    class Guard {
+    public:
+        Guard();
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        ~Guard();
+    };
+
+    static Guard pin();
+    static void retire(void*, void (*)(void*));
+
+    template<typename T>
+    static void retire(T*);
+
+    static bool try_advance();
+    static std::size_t collect();
+    static std::size_t pending();
+
+private:
+    struct Retired {
+        void* object;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+
+    struct Record {
+        std::atomic<std::uint64_t> state;
+        std::atomic<bool> claimed;
+        Record* next;
+        unsigned nesting;
+        std::size_t since_collect;
+        std::vector<Retired> retired;
+    };
+
+    struct ThreadSlot {
+        Record* record = nullptr;
+        ~ThreadSlot();
+    };
+
+    struct Domain {
+        std::atomic<std::uint64_t> epoch{2};
+        std::atomic<Record*> records{nullptr};
+        std::mutex orphans_mutex;
+        std::vector<Retired> orphans;
+    };
+
+    static Domain& domain();
+    static Record* local();
+    static std::size_t free_expired(std::vector<Retired>&, std::uint64_t);
+};
+
+#include "epochReclaimerImplementation.tpp"
+
+#endif
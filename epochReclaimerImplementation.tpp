@@ -0,0 +1,222 @@
+#include "epochReclaimerHeader.hpp"
+
+#include <utility>
+
+/**
+ * @brief Pins the calling thread to the current epoch.
+ *
+ * While any guard is alive on a thread, objects retired after the thread was pinned are not
+ * freed, so pointers read from a lock-free structure stay valid. Guards nest; only the outermost
+ * one publishes the epoch.
+ */
+inline EpochReclaimer::Guard::Guard() {
+    Record* record = local();
+    if (record->nesting++ == 0) {
+        std::uint64_t epoch = domain().epoch.load(std::memory_order_relaxed);
+        record->state.store(epoch << 1 | 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+/**
+ * @brief Unpins the calling thread when the outermost guard is destroyed.
+ */
+inline EpochReclaimer::Guard::~Guard() {
+    Record* record = local();
+    if (--record->nesting == 0) {
+        record->state.store(0, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Hands a thread's unfreed objects to the domain when the thread exits.
+ *
+ * The record is released for reuse by a later thread.
+ */
+inline EpochReclaimer::ThreadSlot::~ThreadSlot() {
+    if (!record) {
+        return;
+    }
+    if (!record->retired.empty()) {
+        Domain& shared = domain();
+        std::lock_guard<std::mutex> lock(shared.orphans_mutex);
+        shared.orphans.insert(shared.orphans.end(), record->retired.begin(), record->retired.end());
+    }
+    record->retired.clear();
+    record->retired.shrink_to_fit();
+    record->since_collect = 0;
+    record->state.store(0, std::memory_order_release);
+    record->claimed.store(false, std::memory_order_release);
+}
+
+/**
+ * @brief Returns the process-wide reclamation domain.
+ *
+ * The domain is intentionally never destroyed, so threads that exit during program shutdown can
+ * still hand over their unfreed objects.
+ *
+ * @return The domain.
+ */
+inline EpochReclaimer::Domain& EpochReclaimer::domain() {
+    static Domain* shared = new Domain();
+    return *shared;
+}
+
+/**
+ * @brief Returns the calling thread's record, claiming a free one or registering a new one on first use.
+ *
+ * @return The thread's record.
+ */
+inline EpochReclaimer::Record* EpochReclaimer::local() {
+    thread_local ThreadSlot slot;
+    if (slot.record) {
+        return slot.record;
+    }
+    Domain& shared = domain();
+    for (Record* record = shared.records.load(std::memory_order_acquire); record; record = record->next) {
+        bool expected = false;
+        if (!record->claimed.load(std::memory_order_relaxed) &&
+            record->claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            slot.record = record;
+            return record;
+        }
+    }
+    Record* record = new Record();
+    record->state.store(0, std::memory_order_relaxed);
+    record->claimed.store(true, std::memory_order_relaxed);
+    record->nesting = 0;
+    record->since_collect = 0;
+    record->next = shared.records.load(std::memory_order_relaxed);
+    while (!shared.records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    slot.record = record;
+    return record;
+}
+
+/**
+ * @brief Pins the calling thread for the lifetime of the returned guard.
+ *
+ * @return The guard.
+ */
+inline EpochReclaimer::Guard EpochReclaimer::pin() {
+    return Guard();
+}
+
+/**
+ * @brief Schedules an object that is no longer reachable from its structure to be freed.
+ *
+ * The object is freed once every thread that was pinned when it was retired has unpinned, which
+ * is detected when the global epoch has advanced twice past the retirement. Every
+ * `EPOCH_RECLAIMER_COLLECT_INTERVAL` retirements the calling thread tries to advance the epoch and
+ * frees what has expired.
+ *
+ * @param object The unlinked object.
+ * @param deleter Called with `object` to free it.
+ */
+inline void EpochReclaimer::retire(void* object, void (*deleter)(void*)) {
+    Record* record = local();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::uint64_t epoch = domain().epoch.load(std::memory_order_seq_cst);
+    record->retired.push_back({object, deleter, epoch});
+    if (++record->since_collect >= EPOCH_RECLAIMER_COLLECT_INTERVAL) {
+        record->since_collect = 0;
+        collect();
+    }
+}
+
+/**
+ * @brief Schedules an object allocated with `new` to be deleted.
+ *
+ * @param object The unlinked object.
+ */
+template <typename T>
+void EpochReclaimer::retire(T* object) {
+    retire(static_cast<void*>(object), [](void* ptr) { delete static_cast<T*>(ptr); });
+}
+
+/**
+ * @brief Advances the global epoch if every pinned thread has observed the current one.
+ *
+ * @return True if the epoch is now newer than when the call started.
+ */
+inline bool EpochReclaimer::try_advance() {
+    Domain& shared = domain();
+    std::uint64_t epoch = shared.epoch.load(std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (Record* record = shared.records.load(std::memory_order_acquire); record; record = record->next) {
+        std::uint64_t state = record->state.load(std::memory_order_acquire);
+        if ((state & 1) && (state >> 1) != epoch) {
+            return false;
+        }
+    }
+    shared.epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+    return true;
+}
+
+/**
+ * @brief Frees the retired objects in a list whose retirement is at least two epochs old.
+ *
+ * Expired objects are taken out of the list before their deleters run, so a deleter may retire
+ * further objects.
+ *
+ * @param retired The list to collect from.
+ * @param epoch The current global epoch.
+ * @return The number of objects freed.
+ */
+inline std::size_t EpochReclaimer::free_expired(std::vector<Retired>& retired, std::uint64_t epoch) {
+    std::vector<Retired> expired;
+    std::size_t kept = 0;
+    for (Retired& item : retired) {
+        if (item.epoch + 2 <= epoch) {
+            expired.push_back(item);
+        }
+        else {
+            retired[kept++] = item;
+        }
+    }
+    retired.resize(kept);
+    for (Retired& item : expired) {
+        item.deleter(item.object);
+    }
+    return expired.size();
+}
+
+/**
+ * @brief Tries to advance the epoch and frees the calling thread's expired objects.
+ *
+ * Objects left behind by exited threads are collected too when no other thread is doing so.
+ * Called by an unpinned thread with no other thread pinned, this frees everything retired so far.
+ *
+ * @return The number of objects freed.
+ */
+inline std::size_t EpochReclaimer::collect() {
+    try_advance();
+    try_advance();
+    Domain& shared = domain();
+    std::uint64_t epoch = shared.epoch.load(std::memory_order_seq_cst);
+    std::size_t freed = free_expired(local()->retired, epoch);
+    std::vector<Retired> orphans;
+    {
+        std::unique_lock<std::mutex> lock(shared.orphans_mutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            orphans.swap(shared.orphans);
+        }
+    }
+    if (!orphans.empty()) {
+        freed += free_expired(orphans, epoch);
+        std::lock_guard<std::mutex> lock(shared.orphans_mutex);
+        shared.orphans.insert(shared.orphans.end(), orphans.begin(), orphans.end());
+    }
+    return freed;
+}
+
+/**
+ * @brief Returns how many objects retired by the calling thread or by exited threads are not yet freed.
+ *
+ * @return The number of pending objects.
+ */
+inline std::size_t EpochReclaimer::pending() {
+    Domain& shared = domain();
+    std::lock_guard<std::mutex> lock(shared.orphans_mutex);
+    return local()->retired.size() + shared.orphans.size();
+}
@@ -0,0 +1,137 @@
+#ifndef FIFO_LIST_H
+#define FIFO_LIST_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "nodePoolHeader.hpp"
+
+#ifndef FIFO_LIST_RING_BYTES
+#define FIFO_LIST_RING_BYTES 256
+#endif
+
+template <typename T>
+class FifoList {
+private:
+    static constexpr std::size_t ring_capacity = std::bit_floor(std::max<std::size_t>(4, FIFO_LIST_RING_BYTES / sizeof(T)));
+    static constexpr std::size_t ring_mask = ring_capacity - 1;
+
+    struct Ring {
+        std::size_t head;
+        std::size_t count;
+        Ring* next;
+        Ring* prev;
+        alignas(T) unsigned char storage[ring_capacity * sizeof(T)];
+        T* at(std::size_t);
+        const T* at(std::size_t) const;
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+    };
+
+    Ring* head;
+    Ring* tail;
+    Ring* spare;
+    std::size_t size;
+
+    Ring* link_ring_after(Ring*);
+    void release_ring(Ring*);
+    Ring* split(Ring*);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator(const FifoList*, Ring*, std::size_t);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator& operator--();
+        iterator operator++(int);
+        iterator operator--(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+        friend class FifoList<T>;
+    private:
+        const FifoList* owner;
+        Ring* ring;
+        std::size_t index;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = const T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator(const FifoList*, const Ring*, std::size_t);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int);
+        const_iterator operator--(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+    private:
+        const FifoList* owner;
+        const Ring* ring;
+        std::size_t index;
+    };
+
+    FifoList();
+    FifoList(const FifoList&) = delete;
+    FifoList& operator=(const FifoList&) = delete;
+    ~FifoList();
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    void push_back(const T&);
+    void push_back(T&&);
+    void push_front(const T&);
+    void push_front(T&&);
+
+    template<typename... Args>
+    reference emplace_back(Args&&...);
+
+    template<typename... Args>
+    reference emplace_front(Args&&...);
+
+    void pop_front();
+    void pop_back();
+    iterator insert(iterator, const T&);
+    iterator insert(iterator, T&&);
+    iterator erase(iterator);
+    void clear();
+
+    iterator begin();
+    iterator end();
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "fifoListImplementation.tpp"
+
+#endif
@@ -0,0 +1,717 @@
+#include "fifoListHeader.hpp"
+
+/**
+ * @brief Returns the element at a logical position of the ring.
+ *
+ * @param i The position, counted from the ring's current head.
+ * @return A pointer to the slot; only holds an element for `i < count`.
+ */
+template <typename T>
+T* FifoList<T>::Ring::at(std::size_t i) {
+    return std::launder(reinterpret_cast<T*>(storage) + ((head + i) & ring_mask));
+}
+
+/**
+ * @brief Returns the element at a logical position of the ring.
+ *
+ * @param i The position, counted from the ring's current head.
+ * @return A const pointer to the slot; only holds an element for `i < count`.
+ */
+template <typename T>
+const T* FifoList<T>::Ring::at(std::size_t i) const {
+    return std::launder(reinterpret_cast<const T*>(storage) + ((head + i) & ring_mask));
+}
+
+/**
+ * @brief Allocates a ring from the shared slab pool.
+ *
+ * @param bytes The size of the ring, always `sizeof(Ring)`.
+ * @return Storage for one ring.
+ */
+template <typename T>
+void* FifoList<T>::Ring::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Ring), alignof(Ring)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a ring's storage to the shared slab pool.
+ *
+ * @param ptr The ring storage to release.
+ */
+template <typename T>
+void FifoList<T>::Ring::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Ring), alignof(Ring)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Links an empty ring after another, reusing the spare ring when there is one.
+ *
+ * @param prev The ring to link after, or nullptr to link at the front.
+ * @return The new ring.
+ */
+template <typename T>
+typename FifoList<T>::Ring* FifoList<T>::link_ring_after(Ring* prev) {
+    Ring* ring = spare ? std::exchange(spare, nullptr) : new Ring;
+    ring->head = 0;
+    ring->count = 0;
+    ring->prev = prev;
+    ring->next = prev ? prev->next : head;
+    if (ring->next) {
+        ring->next->prev = ring;
+    }
+    else {
+        tail = ring;
+    }
+    if (prev) {
+        prev->next = ring;
+    }
+    else {
+        head = ring;
+    }
+    return ring;
+}
+
+/**
+ * @brief Unlinks an empty ring and keeps it as the spare, freeing it if a spare is already held.
+ *
+ * @param ring The ring to release.
+ */
+template <typename T>
+void FifoList<T>::release_ring(Ring* ring) {
+    if (ring->prev) {
+        ring->prev->next = ring->next;
+    }
+    else {
+        head = ring->next;
+    }
+    if (ring->next) {
+        ring->next->prev = ring->prev;
+    }
+    else {
+        tail = ring->prev;
+    }
+    if (spare) {
+        delete ring;
+    }
+    else {
+        spare = ring;
+    }
+}
+
+/**
+ * @brief Moves the upper half of a full ring into a new ring linked right after it.
+ *
+ * @param ring The full ring to split.
+ * @return The new ring holding the upper half.
+ */
+template <typename T>
+typename FifoList<T>::Ring* FifoList<T>::split(Ring* ring) {
+    constexpr std::size_t half = ring_capacity / 2;
+    Ring* upper = link_ring_after(ring);
+    for (std::size_t i = half; i < ring_capacity; ++i) {
+        ::new (static_cast<void*>(upper->at(upper->count))) T(std::move(*ring->at(i)));
+        ++upper->count;
+    }
+    for (std::size_t i = half; i < ring_capacity; ++i) {
+        std::destroy_at(ring->at(i));
+    }
+    ring->count = half;
+    return upper;
+}
+
+/**
+ * @brief Constructor for an iterator.
+ *
+ * @param list The list the iterator belongs to, used to step back from `end()`.
+ * @param r The ring holding the element, or nullptr for `end()`.
+ * @param i The element's position within the ring.
+ */
+template <typename T>
+FifoList<T>::iterator::iterator(const FifoList* list, Ring* r, std::size_t i) : owner(list), ring(r), index(i) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A reference to the current element.
+ */
+template <typename T>
+typename FifoList<T>::iterator::reference FifoList<T>::iterator::operator*() const {
+    return *ring->at(index);
+}
+
+/**
+ * @brief Arrow operator for iterator.
+ *
+ * @return A pointer to the current element.
+ */
+template <typename T>
+typename FifoList<T>::iterator::pointer FifoList<T>::iterator::operator->() const {
+    return ring->at(index);
+}
+
+/**
+ * @brief Prefix increment operator for iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename FifoList<T>::iterator& FifoList<T>::iterator::operator++() {
+    if (++index == ring->count) {
+        ring = ring->next;
+        index = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for iterator; decrementing `end()` yields the last element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename FifoList<T>::iterator& FifoList<T>::iterator::operator--() {
+    if (!ring || index == 0) {
+        ring = ring ? ring->prev : owner->tail;
+        index = ring->count - 1;
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename FifoList<T>::iterator FifoList<T>::iterator::operator++(int) {
+    iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename FifoList<T>::iterator FifoList<T>::iterator::operator--(int) {
+    iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators reference the same element, false otherwise.
+ */
+template <typename T>
+bool FifoList<T>::iterator::operator==(const iterator& other) const {
+    return ring == other.ring && index == other.index;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators reference different elements, false otherwise.
+ */
+template <typename T>
+bool FifoList<T>::iterator::operator!=(const iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructor for a const iterator.
+ *
+ * @param list The list the iterator belongs to, used to step back from `cend()`.
+ * @param r The ring holding the element, or nullptr for `cend()`.
+ * @param i The element's position within the ring.
+ */
+template <typename T>
+FifoList<T>::const_iterator::const_iterator(const FifoList* list, const Ring* r, std::size_t i) : owner(list), ring(r), index(i) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return A const reference to the current element.
+ */
+template <typename T>
+typename FifoList<T>::const_iterator::reference FifoList<T>::const_iterator::operator*() const {
+    return *ring->at(index);
+}
+
+/**
+ * @brief Arrow operator for const iterator.
+ *
+ * @return A const pointer to the current element.
+ */
+template <typename T>
+typename FifoList<T>::const_iterator::pointer FifoList<T>::const_iterator::operator->() const {
+    return ring->at(index);
+}
+
+/**
+ * @brief Prefix increment operator for const iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename FifoList<T>::const_iterator& FifoList<T>::const_iterator::operator++() {
+    if (++index == ring->count) {
+        ring = ring->next;
+        index = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for const iterator; decrementing `cend()` yields the last element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename FifoList<T>::const_iterator& FifoList<T>::const_iterator::operator--() {
+    if (!ring || index == 0) {
+        ring = ring ? ring->prev : owner->tail;
+        index = ring->count - 1;
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename FifoList<T>::const_iterator FifoList<T>::const_iterator::operator++(int) {
+    const_iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for const iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename FifoList<T>::const_iterator FifoList<T>::const_iterator::operator--(int) {
+    const_iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators reference the same element, false otherwise.
+ */
+template <typename T>
+bool FifoList<T>::const_iterator::operator==(const const_iterator& other) const {
+    return ring == other.ring && index == other.index;
+}
+
+/**
+ * @brief Inequality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators reference different elements, false otherwise.
+ */
+template <typename T>
+bool FifoList<T>::const_iterator::operator!=(const const_iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructs an empty list; no ring is allocated until the first element arrives.
+ */
+template <typename T>
+FifoList<T>::FifoList() : head(nullptr), tail(nullptr), spare(nullptr), size(0) { }
+
+/**
+ * @brief Destroys all elements and frees every ring, including the spare.
+ */
+template <typename T>
+FifoList<T>::~FifoList() {
+    clear();
+    delete spare;
+}
+
+/**
+ * @brief Accessor to the front element of the list.
+ *
+ * @return A reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename FifoList<T>::reference FifoList<T>::front() {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return *head->at(0);
+}
+
+/**
+ * @brief Const accessor to the front element of the list.
+ *
+ * @return A const reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename FifoList<T>::const_reference FifoList<T>::front() const {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return *head->at(0);
+}
+
+/**
+ * @brief Accessor to the back element of the list.
+ *
+ * @return A reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename FifoList<T>::reference FifoList<T>::back() {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return *tail->at(tail->count - 1);
+}
+
+/**
+ * @brief Const accessor to the back element of the list.
+ *
+ * @return A const reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename FifoList<T>::const_reference FifoList<T>::back() const {
+    if (size == 0) {
+        throw std::out_of_range("List is empty");
+    }
+    return *tail->at(tail->count - 1);
+}
+
+/**
+ * @brief Adds an element to the back of the list.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void FifoList<T>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+/**
+ * @brief Adds an r-value element to the back of the list.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void FifoList<T>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+/**
+ * @brief Adds an element to the front of the list.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void FifoList<T>::push_front(const T& value) {
+    emplace_front(value);
+}
+
+/**
+ * @brief Adds an r-value element to the front of the list.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void FifoList<T>::push_front(T&& value) {
+    emplace_front(std::move(value));
+}
+
+/**
+ * @brief Constructs an element at the back of the list.
+ *
+ * The element goes into the free slot after the back ring's last element; only when that ring
+ * is full is another ring linked, taken from the spare if one is parked.
+ *
+ * @param args The arguments to construct the new element.
+ * @return A reference to the new element.
+ */
+template <typename T>
+template<typename... Args>
+typename FifoList<T>::reference FifoList<T>::emplace_back(Args&&... args) {
+    if (!tail || tail->count == ring_capacity) {
+        link_ring_after(tail);
+    }
+    T* slot = tail->at(tail->count);
+    try {
+        ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+    }
+    catch (...) {
+        if (tail->count == 0 && head != tail) {
+            release_ring(tail);
+        }
+        throw;
+    }
+    ++tail->count;
+    ++size;
+    return *slot;
+}
+
+/**
+ * @brief Constructs an element at the front of the list.
+ *
+ * @param args The arguments to construct the new element.
+ * @return A reference to the new element.
+ */
+template <typename T>
+template<typename... Args>
+typename FifoList<T>::reference FifoList<T>::emplace_front(Args&&... args) {
+    if (!head || head->count == ring_capacity) {
+        link_ring_after(nullptr);
+    }
+    T* slot = head->at(ring_capacity - 1);
+    try {
+        ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+    }
+    catch (...) {
+        if (head->count == 0 && head != tail) {
+            release_ring(head);
+        }
+        throw;
+    }
+    head->head = (head->head - 1) & ring_mask;
+    ++head->count;
+    ++size;
+    return *slot;
+}
+
+/**
+ * @brief Removes the first element from the list; does nothing if the list is empty.
+ *
+ * A ring emptied by this is parked as the spare, unless it is the only ring, which stays in place
+ * so that a short queue keeps cycling through one buffer without touching the allocator.
+ */
+template <typename T>
+void FifoList<T>::pop_front() {
+    if (size == 0) {
+        return;
+    }
+    std::destroy_at(head->at(0));
+    head->head = (head->head + 1) & ring_mask;
+    --size;
+    if (--head->count == 0 && head != tail) {
+        release_ring(head);
+    }
+}
+
+/**
+ * @brief Removes the last element from the list; does nothing if the list is empty.
+ */
+template <typename T>
+void FifoList<T>::pop_back() {
+    if (size == 0) {
+        return;
+    }
+    std::destroy_at(tail->at(tail->count - 1));
+    --size;
+    if (--tail->count == 0 && head != tail) {
+        release_ring(tail);
+    }
+}
+
+/**
+ * @brief Inserts a copy of a value before the given position.
+ *
+ * @param pos The position to insert before.
+ * @param value The value to insert.
+ * @return An iterator to the inserted element.
+ */
+template <typename T>
+typename FifoList<T>::iterator FifoList<T>::insert(iterator pos, const T& value) {
+    return insert(pos, T(value));
+}
+
+/**
+ * @brief Inserts an r-value before the given position.
+ *
+ * Elements of the target ring are shifted towards whichever end is nearer. A full ring is split
+ * first, linking its upper half in as a new ring, so no insert moves more than one ring's worth
+ * of elements.
+ *
+ * @param pos The position to insert before.
+ * @param value The value to insert.
+ * @return An iterator to the inserted element.
+ */
+template <typename T>
+typename FifoList<T>::iterator FifoList<T>::insert(iterator pos, T&& value) {
+    if (!pos.ring) {
+        emplace_back(std::move(value));
+        return iterator(this, tail, tail->count - 1);
+    }
+    Ring* ring = pos.ring;
+    std::size_t index = pos.index;
+    if (ring->count == ring_capacity) {
+        Ring* upper = split(ring);
+        if (index > ring->count) {
+            index -= ring->count;
+            ring = upper;
+        }
+    }
+    if (index == ring->count) {
+        ::new (static_cast<void*>(ring->at(index))) T(std::move(value));
+    }
+    else if (index == 0) {
+        ::new (static_cast<void*>(ring->at(ring_capacity - 1))) T(std::move(value));
+        ring->head = (ring->head - 1) & ring_mask;
+    }
+    else if (index < ring->count / 2) {
+        ring->head = (ring->head - 1) & ring_mask;
+        ::new (static_cast<void*>(ring->at(0))) T(std::move(*ring->at(1)));
+        for (std::size_t i = 1; i < index; ++i) {
+            *ring->at(i) = std::move(*ring->at(i + 1));
+        }
+        *ring->at(index) = std::move(value);
+    }
+    else {
+        ::new (static_cast<void*>(ring->at(ring->count))) T(std::move(*ring->at(ring->count - 1)));
+        for (std::size_t i = ring->count - 1; i > index; --i) {
+            *ring->at(i) = std::move(*ring->at(i - 1));
+        }
+        *ring->at(index) = std::move(value);
+    }
+    ++ring->count;
+    ++size;
+    return iterator(this, ring, index);
+}
+
+/**
+ * @brief Removes the element at the given position, shifting whichever side of its ring is shorter.
+ *
+ * @param pos A valid element position.
+ * @return An iterator to the element that followed the removed one.
+ */
+template <typename T>
+typename FifoList<T>::iterator FifoList<T>::erase(iterator pos) {
+    Ring* ring = pos.ring;
+    std::size_t index = pos.index;
+    if (index < ring->count / 2) {
+        for (std::size_t i = index; i > 0; --i) {
+            *ring->at(i) = std::move(*ring->at(i - 1));
+        }
+        std::destroy_at(ring->at(0));
+        ring->head = (ring->head + 1) & ring_mask;
+    }
+    else {
+        for (std::size_t i = index; i + 1 < ring->count; ++i) {
+            *ring->at(i) = std::move(*ring->at(i + 1));
+        }
+        std::destroy_at(ring->at(ring->count - 1));
+    }
+    --ring->count;
+    --size;
+    if (ring->count == 0) {
+        Ring* next = ring->next;
+        if (head != tail) {
+            release_ring(ring);
+        }
+        return iterator(this, next, 0);
+    }
+    if (index == ring->count) {
+        return iterator(this, ring->next, 0);
+    }
+    return iterator(this, ring, index);
+}
+
+/**
+ * @brief Destroys every element and frees the rings, parking one as the spare.
+ */
+template <typename T>
+void FifoList<T>::clear() {
+    while (head) {
+        Ring* ring = head;
+        for (std::size_t i = 0; i < ring->count; ++i) {
+            std::destroy_at(ring->at(i));
+        }
+        ring->count = 0;
+        release_ring(ring);
+    }
+    size = 0;
+}
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return An iterator to the first element.
+ */
+template <typename T>
+typename FifoList<T>::iterator FifoList<T>::begin() {
+    return iterator(this, size ? head : nullptr, 0);
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return The end iterator.
+ */
+template <typename T>
+typename FifoList<T>::iterator FifoList<T>::end() {
+    return iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Returns a constant iterator to the first element.
+ *
+ * @return A constant iterator to the first element.
+ */
+template <typename T>
+typename FifoList<T>::const_iterator FifoList<T>::cbegin() const {
+    return const_iterator(this, size ? head : nullptr, 0);
+}
+
+/**
+ * @brief Returns a constant iterator past the last element.
+ *
+ * @return The constant end iterator.
+ */
+template <typename T>
+typename FifoList<T>::const_iterator FifoList<T>::cend() const {
+    return const_iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @return The size of the list.
+ */
+template <typename T>
+typename FifoList<T>::size_type FifoList<T>::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * @return `true` if the list is empty, `false` otherwise.
+ */
+template <typename T>
+bool FifoList<T>::empty() const {
+    return size == 0;
+}
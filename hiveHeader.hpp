@@ -0,0 +1,161 @@
+#ifndef HIVE_H
+#define HIVE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#ifndef HIVE_MIN_BLOCK_CAPACITY
+#define HIVE_MIN_BLOCK_CAPACITY 8
+#endif
+
+#ifndef HIVE_MAX_BLOCK_CAPACITY
+#define HIVE_MAX_BLOCK_CAPACITY 8192
+#endif
+
+template <typename T>
+class Hive {
+    static_assert(HIVE_MIN_BLOCK_CAPACITY >= 2 && HIVE_MIN_BLOCK_CAPACITY <= HIVE_MAX_BLOCK_CAPACITY,
+                  "HIVE_MIN_BLOCK_CAPACITY must be at least 2 and at most HIVE_MAX_BLOCK_CAPACITY");
+    static_assert(HIVE_MAX_BLOCK_CAPACITY < 65535, "skipfield entries are 16 bits wide");
+
+private:
+    using skip_type = std::uint16_t;
+    static constexpr skip_type no_slot = 0xFFFF;
+
+    union Slot {
+        T value;
+        struct {
+            skip_type prev;
+            skip_type next;
+        } free;
+        Slot() { }
+        ~Slot() { }
+    };
+
+    struct Block {
+        std::unique_ptr<Slot[]> slots;
+        std::unique_ptr<skip_type[]> skip;
+        std::size_t capacity;
+        std::size_t top;
+        std::size_t count;
+        skip_type free_head;
+        Block* next;
+        Block* prev;
+        Block* next_with_free;
+        Block* prev_with_free;
+        explicit Block(std::size_t);
+    };
+
+    Block* first;
+    Block* last;
+    Block* blocks_with_free;
+    std::size_t size;
+    std::size_t total_capacity;
+
+    Block* add_block();
+    void free_block(Block*);
+    void link_free_block(Block*);
+    void unlink_free_block(Block*);
+    static void push_free(Block*, skip_type);
+    static void unlink_free(Block*, skip_type);
+
+    template<typename... Args>
+    std::pair<Block*, std::size_t> construct_slot(Args&&...);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator();
+        iterator(const Hive*, Block*, std::size_t);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator& operator--();
+        iterator operator++(int);
+        iterator operator--(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+        friend class Hive<T>;
+    private:
+        const Hive* owner;
+        Block* block;
+        std::size_t index;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = const T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator();
+        const_iterator(const Hive*, const Block*, std::size_t);
+        const_iterator(const iterator&);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int);
+        const_iterator operator--(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+        friend class Hive<T>;
+    private:
+        const Hive* owner;
+        const Block* block;
+        std::size_t index;
+    };
+
+    Hive();
+    Hive(std::initializer_list<T>);
+    Hive(const Hive&);
+    Hive(Hive&&) noexcept;
+    Hive& operator=(const Hive&);
+    Hive& operator=(Hive&&) noexcept;
+    ~Hive();
+
+    iterator insert(const T&);
+    iterator insert(T&&);
+
+    template<typename... Args>
+    iterator emplace(Args&&...);
+
+    iterator erase(iterator);
+    iterator erase(const_iterator);
+    void clear();
+    void swap(Hive&) noexcept;
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    size_type capacity() const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "hiveImplementation.tpp"
+
+#endif
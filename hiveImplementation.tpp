@@ -0,0 +1,765 @@
+#include "hiveHeader.hpp"
+
+/**
+ * @brief Allocates an empty block with room for `slots` elements.
+ *
+ * The skipfield gets one extra zero entry past the last slot so that erasing the last slot can
+ * look at its right neighbour without a bounds check.
+ *
+ * @param slots The capacity of the block.
+ */
+template <typename T>
+Hive<T>::Block::Block(std::size_t slots)
+    : slots(std::make_unique_for_overwrite<Slot[]>(slots)), skip(std::make_unique<skip_type[]>(slots + 1)),
+      capacity(slots), top(0), count(0), free_head(no_slot),
+      next(nullptr), prev(nullptr), next_with_free(nullptr), prev_with_free(nullptr) { }
+
+/**
+ * @brief Appends a new block, sized to the current element count within the configured bounds.
+ *
+ * Sizing each block like the elements so far makes the capacity grow geometrically until blocks
+ * reach `HIVE_MAX_BLOCK_CAPACITY`.
+ *
+ * @return The new block.
+ */
+template <typename T>
+typename Hive<T>::Block* Hive<T>::add_block() {
+    std::size_t slots = std::clamp<std::size_t>(size, HIVE_MIN_BLOCK_CAPACITY, HIVE_MAX_BLOCK_CAPACITY);
+    Block* block = new Block(slots);
+    block->prev = last;
+    if (last) {
+        last->next = block;
+    }
+    else {
+        first = block;
+    }
+    last = block;
+    total_capacity += slots;
+    return block;
+}
+
+/**
+ * @brief Unlinks and frees a block that no longer holds any element.
+ *
+ * @param block The empty block.
+ */
+template <typename T>
+void Hive<T>::free_block(Block* block) {
+    if (block->free_head != no_slot) {
+        unlink_free_block(block);
+    }
+    if (block->prev) {
+        block->prev->next = block->next;
+    }
+    else {
+        first = block->next;
+    }
+    if (block->next) {
+        block->next->prev = block->prev;
+    }
+    else {
+        last = block->prev;
+    }
+    total_capacity -= block->capacity;
+    delete block;
+}
+
+/**
+ * @brief Adds a block to the list of blocks with erased slots available for reuse.
+ *
+ * @param block The block that just gained its first erased run.
+ */
+template <typename T>
+void Hive<T>::link_free_block(Block* block) {
+    block->prev_with_free = nullptr;
+    block->next_with_free = blocks_with_free;
+    if (blocks_with_free) {
+        blocks_with_free->prev_with_free = block;
+    }
+    blocks_with_free = block;
+}
+
+/**
+ * @brief Removes a block from the list of blocks with erased slots available for reuse.
+ *
+ * @param block The block whose last erased run was reused, or that is being freed.
+ */
+template <typename T>
+void Hive<T>::unlink_free_block(Block* block) {
+    if (block->prev_with_free) {
+        block->prev_with_free->next_with_free = block->next_with_free;
+    }
+    else {
+        blocks_with_free = block->next_with_free;
+    }
+    if (block->next_with_free) {
+        block->next_with_free->prev_with_free = block->prev_with_free;
+    }
+    block->next_with_free = block->prev_with_free = nullptr;
+}
+
+/**
+ * @brief Pushes the first slot of an erased run onto its block's free list.
+ *
+ * The links are stored in the erased slot itself.
+ *
+ * @param block The block.
+ * @param slot The first slot of the run.
+ */
+template <typename T>
+void Hive<T>::push_free(Block* block, skip_type slot) {
+    block->slots[slot].free.prev = no_slot;
+    block->slots[slot].free.next = block->free_head;
+    if (block->free_head != no_slot) {
+        block->slots[block->free_head].free.prev = slot;
+    }
+    block->free_head = slot;
+}
+
+/**
+ * @brief Removes the first slot of an erased run from its block's free list.
+ *
+ * @param block The block.
+ * @param slot The first slot of the run.
+ */
+template <typename T>
+void Hive<T>::unlink_free(Block* block, skip_type slot) {
+    skip_type prev = block->slots[slot].free.prev;
+    skip_type next = block->slots[slot].free.next;
+    if (prev != no_slot) {
+        block->slots[prev].free.next = next;
+    }
+    else {
+        block->free_head = next;
+    }
+    if (next != no_slot) {
+        block->slots[next].free.prev = prev;
+    }
+}
+
+/**
+ * @brief Constructs an element in a free slot.
+ *
+ * The first slot of an erased run is reused if any block has one; otherwise the element goes
+ * after the last used slot of the last block, and a new block is added when that block is full.
+ * The skipfield is only updated once the element has been constructed, so a throwing constructor
+ * leaves the hive unchanged.
+ *
+ * @param args Arguments forwarded to the constructor of `T`.
+ * @return The block and slot of the new element.
+ */
+template <typename T>
+template <typename... Args>
+std::pair<typename Hive<T>::Block*, std::size_t> Hive<T>::construct_slot(Args&&... args) {
+    if (Block* block = blocks_with_free) {
+        skip_type slot = block->free_head;
+        std::size_t run = block->skip[slot];
+        auto links = block->slots[slot].free;
+        try {
+            ::new (static_cast<void*>(std::addressof(block->slots[slot].value))) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            block->slots[slot].free = links;
+            throw;
+        }
+        block->skip[slot] = 0;
+        block->free_head = links.next;
+        if (links.next != no_slot) {
+            block->slots[links.next].free.prev = no_slot;
+        }
+        if (run > 1) {
+            block->skip[slot + 1] = block->skip[slot + run - 1] = static_cast<skip_type>(run - 1);
+            push_free(block, static_cast<skip_type>(slot + 1));
+        }
+        if (block->free_head == no_slot) {
+            unlink_free_block(block);
+        }
+        ++block->count;
+        ++size;
+        return {block, slot};
+    }
+
+    bool fresh = !last || last->top == last->capacity;
+    Block* block = fresh ? add_block() : last;
+    try {
+        ::new (static_cast<void*>(std::addressof(block->slots[block->top].value))) T(std::forward<Args>(args)...);
+    }
+    catch (...) {
+        if (fresh) {
+            free_block(block);
+        }
+        throw;
+    }
+    ++block->count;
+    ++size;
+    return {block, block->top++};
+}
+
+/**
+ * @brief Default constructor for an iterator, equal to no other iterator.
+ */
+template <typename T>
+Hive<T>::iterator::iterator() : owner(nullptr), block(nullptr), index(0) { }
+
+/**
+ * @brief Constructor for an iterator.
+ *
+ * @param hive The hive the iterator belongs to, used to step back from `end()`.
+ * @param b The block holding the element, or nullptr for `end()`.
+ * @param i The element's slot within the block.
+ */
+template <typename T>
+Hive<T>::iterator::iterator(const Hive* hive, Block* b, std::size_t i) : owner(hive), block(b), index(i) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A reference to the current element.
+ */
+template <typename T>
+typename Hive<T>::iterator::reference Hive<T>::iterator::operator*() const {
+    return block->slots[index].value;
+}
+
+/**
+ * @brief Arrow operator for iterator.
+ *
+ * @return A pointer to the current element.
+ */
+template <typename T>
+typename Hive<T>::iterator::pointer Hive<T>::iterator::operator->() const {
+    return std::addressof(block->slots[index].value);
+}
+
+/**
+ * @brief Pre-increment operator for iterator.
+ *
+ * One skipfield read jumps over a whole run of erased slots.
+ *
+ * @return A reference to the incremented iterator.
+ */
+template <typename T>
+typename Hive<T>::iterator& Hive<T>::iterator::operator++() {
+    std::size_t next = index + 1;
+    if (next < block->top) {
+        next += block->skip[next];
+    }
+    if (next < block->top) {
+        index = next;
+        return *this;
+    }
+    block = block->next;
+    index = block ? block->skip[0] : 0;
+    return *this;
+}
+
+/**
+ * @brief Pre-decrement operator for iterator.
+ *
+ * Decrementing `end()` moves to the last element.
+ *
+ * @return A reference to the decremented iterator.
+ */
+template <typename T>
+typename Hive<T>::iterator& Hive<T>::iterator::operator--() {
+    if (!block) {
+        block = owner->last;
+        index = block->top;
+    }
+    for (;;) {
+        if (index > 0) {
+            std::size_t previous = index - 1;
+            std::size_t run = block->skip[previous];
+            if (run <= previous) {
+                index = previous - run;
+                return *this;
+            }
+        }
+        block = block->prev;
+        index = block->top;
+    }
+}
+
+/**
+ * @brief Post-increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename Hive<T>::iterator Hive<T>::iterator::operator++(int) {
+    iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+/**
+ * @brief Post-decrement operator for iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename Hive<T>::iterator Hive<T>::iterator::operator--(int) {
+    iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+/**
+ * @brief Equality operator for iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if both iterators point to the same slot.
+ */
+template <typename T>
+bool Hive<T>::iterator::operator==(const iterator& other) const {
+    return block == other.block && index == other.index;
+}
+
+/**
+ * @brief Inequality operator for iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if the iterators point to different slots.
+ */
+template <typename T>
+bool Hive<T>::iterator::operator!=(const iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Default constructor for a const iterator, equal to no other iterator.
+ */
+template <typename T>
+Hive<T>::const_iterator::const_iterator() : owner(nullptr), block(nullptr), index(0) { }
+
+/**
+ * @brief Constructor for a const iterator.
+ *
+ * @param hive The hive the iterator belongs to, used to step back from `end()`.
+ * @param b The block holding the element, or nullptr for `end()`.
+ * @param i The element's slot within the block.
+ */
+template <typename T>
+Hive<T>::const_iterator::const_iterator(const Hive* hive, const Block* b, std::size_t i) : owner(hive), block(b), index(i) { }
+
+/**
+ * @brief Converts a mutable iterator to a const iterator at the same position.
+ *
+ * @param it The iterator to convert.
+ */
+template <typename T>
+Hive<T>::const_iterator::const_iterator(const iterator& it) : owner(it.owner), block(it.block), index(it.index) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return A const reference to the current element.
+ */
+template <typename T>
+typename Hive<T>::const_iterator::reference Hive<T>::const_iterator::operator*() const {
+    return block->slots[index].value;
+}
+
+/**
+ * @brief Arrow operator for const iterator.
+ *
+ * @return A const pointer to the current element.
+ */
+template <typename T>
+typename Hive<T>::const_iterator::pointer Hive<T>::const_iterator::operator->() const {
+    return std::addressof(block->slots[index].value);
+}
+
+/**
+ * @brief Pre-increment operator for const iterator.
+ *
+ * @return A reference to the incremented iterator.
+ */
+template <typename T>
+typename Hive<T>::const_iterator& Hive<T>::const_iterator::operator++() {
+    std::size_t next = index + 1;
+    if (next < block->top) {
+        next += block->skip[next];
+    }
+    if (next < block->top) {
+        index = next;
+        return *this;
+    }
+    block = block->next;
+    index = block ? block->skip[0] : 0;
+    return *this;
+}
+
+/**
+ * @brief Pre-decrement operator for const iterator.
+ *
+ * Decrementing `end()` moves to the last element.
+ *
+ * @return A reference to the decremented iterator.
+ */
+template <typename T>
+typename Hive<T>::const_iterator& Hive<T>::const_iterator::operator--() {
+    if (!block) {
+        block = owner->last;
+        index = block->top;
+    }
+    for (;;) {
+        if (index > 0) {
+            std::size_t previous = index - 1;
+            std::size_t run = block->skip[previous];
+            if (run <= previous) {
+                index = previous - run;
+                return *this;
+            }
+        }
+        block = block->prev;
+        index = block->top;
+    }
+}
+
+/**
+ * @brief Post-increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename Hive<T>::const_iterator Hive<T>::const_iterator::operator++(int) {
+    const_iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+/**
+ * @brief Post-decrement operator for const iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename Hive<T>::const_iterator Hive<T>::const_iterator::operator--(int) {
+    const_iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+/**
+ * @brief Equality operator for const iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if both iterators point to the same slot.
+ */
+template <typename T>
+bool Hive<T>::const_iterator::operator==(const const_iterator& other) const {
+    return block == other.block && index == other.index;
+}
+
+/**
+ * @brief Inequality operator for const iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if the iterators point to different slots.
+ */
+template <typename T>
+bool Hive<T>::const_iterator::operator!=(const const_iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructs an empty hive.
+ */
+template <typename T>
+Hive<T>::Hive() : first(nullptr), last(nullptr), blocks_with_free(nullptr), size(0), total_capacity(0) { }
+
+/**
+ * @brief Constructs a hive holding copies of the given elements.
+ *
+ * @param values The elements to insert.
+ */
+template <typename T>
+Hive<T>::Hive(std::initializer_list<T> values) : Hive() {
+    for (const T& value : values) {
+        insert(value);
+    }
+}
+
+/**
+ * @brief Copy constructor. The copy is compact: it has no erased slots.
+ *
+ * @param other The hive to copy from.
+ */
+template <typename T>
+Hive<T>::Hive(const Hive& other) : Hive() {
+    for (const T& value : other) {
+        insert(value);
+    }
+}
+
+/**
+ * @brief Move constructor, taking over another hive's blocks in O(1).
+ *
+ * @param other The hive to move from; left empty.
+ */
+template <typename T>
+Hive<T>::Hive(Hive&& other) noexcept : Hive() {
+    swap(other);
+}
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param other The hive to copy from.
+ * @return A reference to this hive.
+ */
+template <typename T>
+Hive<T>& Hive<T>::operator=(const Hive& other) {
+    if (this != &other) {
+        Hive copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+/**
+ * @brief Move assignment operator, destroying the current elements and taking over another hive's blocks.
+ *
+ * @param other The hive to move from; left empty.
+ * @return A reference to this hive.
+ */
+template <typename T>
+Hive<T>& Hive<T>::operator=(Hive&& other) noexcept {
+    if (this != &other) {
+        clear();
+        swap(other);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys the elements and frees every block.
+ */
+template <typename T>
+Hive<T>::~Hive() {
+    clear();
+}
+
+/**
+ * @brief Inserts a copy of an element.
+ *
+ * @param value The element to copy.
+ * @return An iterator to the new element.
+ */
+template <typename T>
+typename Hive<T>::iterator Hive<T>::insert(const T& value) {
+    return emplace(value);
+}
+
+/**
+ * @brief Inserts an element by moving it.
+ *
+ * @param value The element to move.
+ * @return An iterator to the new element.
+ */
+template <typename T>
+typename Hive<T>::iterator Hive<T>::insert(T&& value) {
+    return emplace(std::move(value));
+}
+
+/**
+ * @brief Constructs an element in O(1), reusing an erased slot when there is one.
+ *
+ * Where the element lands is unspecified. No existing element moves, so iterators, pointers and
+ * references to other elements stay valid.
+ *
+ * @param args Arguments forwarded to the constructor of `T`.
+ * @return An iterator to the new element.
+ */
+template <typename T>
+template <typename... Args>
+typename Hive<T>::iterator Hive<T>::emplace(Args&&... args) {
+    auto [block, slot] = construct_slot(std::forward<Args>(args)...);
+    return iterator(this, block, slot);
+}
+
+/**
+ * @brief Erases an element in O(1).
+ *
+ * The slot joins the erased runs on either side of it in the block's skipfield, updating only the
+ * first and last entries of the merged run, and the run's first slot is kept on the block's free
+ * list for reuse. A block left without elements is freed. Other elements never move.
+ *
+ * @param pos The element to erase; must not be `end()`.
+ * @return An iterator to the next element.
+ */
+template <typename T>
+typename Hive<T>::iterator Hive<T>::erase(iterator pos) {
+    Block* block = pos.block;
+    std::size_t slot = pos.index;
+    iterator next = pos;
+    ++next;
+    std::destroy_at(std::addressof(block->slots[slot].value));
+    --size;
+    if (--block->count == 0) {
+        free_block(block);
+        return next;
+    }
+
+    bool had_free = block->free_head != no_slot;
+    std::size_t left = slot > 0 ? block->skip[slot - 1] : 0;
+    std::size_t right = block->skip[slot + 1];
+    if (!left && !right) {
+        block->skip[slot] = 1;
+        push_free(block, static_cast<skip_type>(slot));
+    }
+    else if (left && !right) {
+        block->skip[slot - left] = block->skip[slot] = static_cast<skip_type>(left + 1);
+    }
+    else if (!left) {
+        unlink_free(block, static_cast<skip_type>(slot + 1));
+        block->skip[slot] = block->skip[slot + right] = static_cast<skip_type>(right + 1);
+        push_free(block, static_cast<skip_type>(slot));
+    }
+    else {
+        unlink_free(block, static_cast<skip_type>(slot + 1));
+        block->skip[slot - left] = block->skip[slot + right] = static_cast<skip_type>(left + right + 1);
+    }
+    if (!had_free) {
+        link_free_block(block);
+    }
+    return next;
+}
+
+/**
+ * @brief Erases an element in O(1).
+ *
+ * @param pos The element to erase; must not be `end()`.
+ * @return An iterator to the next element.
+ */
+template <typename T>
+typename Hive<T>::iterator Hive<T>::erase(const_iterator pos) {
+    return erase(iterator(this, const_cast<Block*>(pos.block), pos.index));
+}
+
+/**
+ * @brief Destroys every element and frees every block.
+ */
+template <typename T>
+void Hive<T>::clear() {
+    while (first) {
+        Block* block = first;
+        first = block->next;
+        for (std::size_t slot = block->skip[0]; slot < block->top;) {
+            std::destroy_at(std::addressof(block->slots[slot].value));
+            if (++slot < block->top) {
+                slot += block->skip[slot];
+            }
+        }
+        delete block;
+    }
+    last = nullptr;
+    blocks_with_free = nullptr;
+    size = 0;
+    total_capacity = 0;
+}
+
+/**
+ * @brief Swaps the contents of two hives in O(1).
+ *
+ * @param other The hive to swap with.
+ */
+template <typename T>
+void Hive<T>::swap(Hive& other) noexcept {
+    std::swap(first, other.first);
+    std::swap(last, other.last);
+    std::swap(blocks_with_free, other.blocks_with_free);
+    std::swap(size, other.size);
+    std::swap(total_capacity, other.total_capacity);
+}
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return An iterator to the first element, or `end()` if the hive is empty.
+ */
+template <typename T>
+typename Hive<T>::iterator Hive<T>::begin() {
+    return first ? iterator(this, first, first->skip[0]) : end();
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return The end iterator.
+ */
+template <typename T>
+typename Hive<T>::iterator Hive<T>::end() {
+    return iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Returns a const iterator to the first element.
+ *
+ * @return A const iterator to the first element, or `end()` if the hive is empty.
+ */
+template <typename T>
+typename Hive<T>::const_iterator Hive<T>::begin() const {
+    return first ? const_iterator(this, first, first->skip[0]) : end();
+}
+
+/**
+ * @brief Returns a const iterator past the last element.
+ *
+ * @return The const end iterator.
+ */
+template <typename T>
+typename Hive<T>::const_iterator Hive<T>::end() const {
+    return const_iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Returns a const iterator to the first element.
+ *
+ * @return A const iterator to the first element, or `cend()` if the hive is empty.
+ */
+template <typename T>
+typename Hive<T>::const_iterator Hive<T>::cbegin() const {
+    return begin();
+}
+
+/**
+ * @brief Returns a const iterator past the last element.
+ *
+ * @return The const end iterator.
+ */
+template <typename T>
+typename Hive<T>::const_iterator Hive<T>::cend() const {
+    return end();
+}
+
+/**
+ * @brief Returns the number of slots in all blocks, used or not.
+ *
+ * @return The total capacity.
+ */
+template <typename T>
+typename Hive<T>::size_type Hive<T>::capacity() const {
+    return total_capacity;
+}
+
+/**
+ * @brief Returns the number of elements in the hive.
+ *
+ * @return The number of elements.
+ */
+template <typename T>
+typename Hive<T>::size_type Hive<T>::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Checks whether the hive is empty.
+ *
+ * @return True if the hive holds no elements.
+ */
+template <typename T>
+bool Hive<T>::empty() const {
+    return size == 0;
+}
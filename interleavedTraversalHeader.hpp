@@ -0,0 +1,41 @@
+#ifndef INTERLEAVED_TRAVERSAL_H
+#define INTERLEAVED_TRAVERSAL_H
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#ifndef INTERLEAVED_TRAVERSAL_WIDTH
+#define INTERLEAVED_TRAVERSAL_WIDTH 16
+#endif
+
+template <std::size_t Width = INTERLEAVED_TRAVERSAL_WIDTH>
+struct InterleavedTraversal {
+    static_assert(Width > 0, "InterleavedTraversal needs at least one lane");
+
+    static void prefetch(const void*);
+
+    template<typename Locate, typename First, typename Next, typename Hit, typename Emit>
+    static void run(std::size_t, Locate, First, Next, Hit, Emit);
+};
+
+template <typename>
+struct IntrusiveNodeOf;
+
+template <typename Node>
+struct IntrusiveNodeOf<Node* Node::*> {
+    using type = Node;
+};
+
+template <auto Next, std::size_t Width = INTERLEAVED_TRAVERSAL_WIDTH, typename Pred>
+void find_batch_intrusive(std::span<typename IntrusiveNodeOf<decltype(Next)>::type* const>,
+                          std::span<typename IntrusiveNodeOf<decltype(Next)>::type*>, Pred);
+
+#include "interleavedTraversalImplementation.tpp"
+
+#endif
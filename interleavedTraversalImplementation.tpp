@@ -0,0 +1,124 @@
+#include "interleavedTraversalHeader.hpp"
+
+/**
+ * @brief Issues a software prefetch for an address that a lane will touch on its next step.
+ *
+ * The hint is a no-op on compilers without a prefetch intrinsic and for null pointers.
+ *
+ * @param address The address that will be read soon.
+ */
+template <std::size_t Width>
+void InterleavedTraversal<Width>::prefetch(const void* address) {
+    if (!address) {
+        return;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0);
+#endif
+}
+
+/**
+ * @brief Runs many independent chain lookups interleaved, so that their cache misses overlap.
+ *
+ * Up to `Width` lookups are in flight at once, each in its own lane of a small state machine
+ * (asynchronous memory access chaining). A lane first prefetches whatever holds its chain head,
+ * then loads the head, then repeatedly tests the current node and moves to the next one. Every
+ * step ends by prefetching the address the lane will read on its next turn, and the loop moves on
+ * to the other lanes instead of waiting, so by the time a lane comes round again its node is
+ * usually in cache. A lane whose lookup finishes immediately starts the next pending lookup.
+ *
+ * Lookups complete out of order; `emit` receives each lookup's index with its result.
+ *
+ * @param count The number of lookups; they are numbered `0` to `count - 1`.
+ * @param locate Returns the address holding lookup `i`'s chain head, to be prefetched.
+ * @param first Returns the first node of lookup `i`'s chain, or nullptr for an empty chain.
+ * @param next Returns the node after a given node, or nullptr at the end of the chain.
+ * @param hit Returns whether a node satisfies lookup `i`.
+ * @param emit Receives lookup `i` together with the matching node, or nullptr if none matched.
+ */
+template <std::size_t Width>
+template<typename Locate, typename First, typename Next, typename Hit, typename Emit>
+void InterleavedTraversal<Width>::run(std::size_t count, Locate locate, First first, Next next, Hit hit, Emit emit) {
+    using Node = std::remove_pointer_t<std::invoke_result_t<First&, std::size_t>>;
+    enum class Stage : unsigned char { load, walk, idle };
+    struct Lane {
+        std::size_t lookup;
+        Node* node;
+        Stage stage;
+    };
+
+    Lane lanes[Width];
+    std::size_t pending = 0;
+    std::size_t active = 0;
+    auto start = [&](Lane& lane) {
+        if (pending == count) {
+            lane.stage = Stage::idle;
+            return false;
+        }
+        lane.lookup = pending++;
+        lane.stage = Stage::load;
+        prefetch(locate(lane.lookup));
+        return true;
+    };
+
+    std::size_t used = 0;
+    while (used < Width && start(lanes[used])) {
+        ++used;
+        ++active;
+    }
+    while (active) {
+        for (std::size_t k = 0; k < used; ++k) {
+            Lane& lane = lanes[k];
+            if (lane.stage == Stage::idle) {
+                continue;
+            }
+            if (lane.stage == Stage::load) {
+                lane.node = first(lane.lookup);
+                lane.stage = Stage::walk;
+                prefetch(lane.node);
+                continue;
+            }
+            Node* node = lane.node;
+            if (!node || hit(lane.lookup, *node)) {
+                emit(lane.lookup, node);
+                if (!start(lane)) {
+                    --active;
+                }
+                continue;
+            }
+            lane.node = next(node);
+            prefetch(lane.node);
+        }
+    }
+}
+
+/**
+ * @brief Looks up one node in each of many intrusive singly linked chains, interleaving the walks.
+ *
+ * Works on any node type that links itself through a `Node* Node::*` member, such as the bucket
+ * chains of an intrusive hash table.
+ *
+ * @tparam Next The member pointer that links a node to the next one in its chain.
+ * @tparam Width The number of chains walked concurrently.
+ * @param heads The first node of each chain; may contain nullptr for empty chains.
+ * @param results Receives, for each chain, the first node satisfying `pred`, or nullptr.
+ * @param pred Called as `pred(i, node)` to test a node of chain `i`.
+ * @throw std::invalid_argument if `heads` and `results` differ in length.
+ */
+template <auto Next, std::size_t Width, typename Pred>
+void find_batch_intrusive(std::span<typename IntrusiveNodeOf<decltype(Next)>::type* const> heads,
+                          std::span<typename IntrusiveNodeOf<decltype(Next)>::type*> results, Pred pred) {
+    using Node = typename IntrusiveNodeOf<decltype(Next)>::type;
+    if (heads.size() != results.size()) {
+        throw std::invalid_argument("find_batch_intrusive: heads and results must have the same length");
+    }
+    InterleavedTraversal<Width>::run(
+        heads.size(),
+        [&](std::size_t i) { return static_cast<const void*>(heads[i]); },
+        [&](std::size_t i) { return heads[i]; },
+        [](Node* node) { return node->*Next; },
+        [&](std::size_t i, const Node& node) { return pred(i, node); },
+        [&](std::size_t i, Node* node) { results[i] = node; });
+}
@@ -0,0 +1,108 @@
+#ifndef LAZY_LIST_H
+#define LAZY_LIST_H
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "nodePoolHeader.hpp"
+
+template <typename T>
+class LazyList {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        template<typename... Args>
+        Node(Args&&...);
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+    };
+
+    struct Source {
+        virtual ~Source() = default;
+        virtual bool pull(LazyList&) = 0;
+    };
+
+    template<typename V>
+    struct RangeSource : Source {
+        V view;
+        std::optional<std::ranges::iterator_t<V>> position;
+        explicit RangeSource(V&&);
+        bool pull(LazyList&) override;
+    };
+
+    template<typename F>
+    struct FunctionSource : Source {
+        F generate;
+        explicit FunctionSource(F&&);
+        bool pull(LazyList&) override;
+    };
+
+    Node* head;
+    Node* tail;
+    std::unique_ptr<Source> source;
+    std::size_t materialized_count;
+
+    template<typename... Args>
+    void link_back(Args&&...);
+    bool pull();
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator();
+        iterator(LazyList*, Node*);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator operator++(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+    private:
+        LazyList* owner;
+        Node* node_ptr;
+    };
+
+    template<std::ranges::input_range R>
+        requires std::ranges::viewable_range<R> && std::constructible_from<T, std::ranges::range_reference_t<R>>
+    explicit LazyList(R&&);
+
+    template<typename F>
+        requires (!std::ranges::range<F>) && std::same_as<std::invoke_result_t<F&>, std::optional<T>>
+    explicit LazyList(F);
+
+    LazyList(const LazyList&) = delete;
+    LazyList& operator=(const LazyList&) = delete;
+    ~LazyList();
+
+    reference front();
+    iterator begin();
+    iterator end();
+    size_type materialize(size_type);
+    size_type materialized() const;
+    bool exhausted() const;
+    size_type getSize();
+    bool empty();
+};
+
+#include "lazyListImplementation.tpp"
+
+#endif
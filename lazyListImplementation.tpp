@@ -0,0 +1,347 @@
+#include "lazyListHeader.hpp"
+
+/**
+ * @brief Variadic constructor for a lazy list node, forwarding arguments to construct the node's data.
+ *
+ * @param args The arguments to construct the node's data.
+ */
+template <typename T>
+template<typename... Args>
+LazyList<T>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) { }
+
+/**
+ * @brief Allocates a node from the shared slab pool.
+ *
+ * @param bytes The size of the node, always `sizeof(Node)`.
+ * @return Storage for one node.
+ */
+template <typename T>
+void* LazyList<T>::Node::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Node), alignof(Node)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a node's storage to the shared slab pool.
+ *
+ * @param ptr The node storage to release.
+ */
+template <typename T>
+void LazyList<T>::Node::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Node), alignof(Node)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Wraps a view of the source range; the range is not touched until the first pull.
+ *
+ * @param source The view to pull elements from.
+ */
+template <typename T>
+template<typename V>
+LazyList<T>::RangeSource<V>::RangeSource(V&& source) : view(std::move(source)) { }
+
+/**
+ * @brief Links the range's next element at the back of the list.
+ *
+ * `begin()` is called on the first pull only, and the range iterator is advanced at the start of
+ * the following pull rather than right after an element is taken. A generator therefore never
+ * computes an element before the list actually needs it.
+ *
+ * @param list The list to append to.
+ * @return `false` if the range is exhausted, `true` otherwise.
+ */
+template <typename T>
+template<typename V>
+bool LazyList<T>::RangeSource<V>::pull(LazyList& list) {
+    if (!position) {
+        position.emplace(std::ranges::begin(view));
+    }
+    else {
+        ++*position;
+    }
+    if (*position == std::ranges::end(view)) {
+        return false;
+    }
+    list.link_back(**position);
+    return true;
+}
+
+/**
+ * @brief Wraps a generating callable.
+ *
+ * @param fn The callable to pull elements from.
+ */
+template <typename T>
+template<typename F>
+LazyList<T>::FunctionSource<F>::FunctionSource(F&& fn) : generate(std::move(fn)) { }
+
+/**
+ * @brief Calls the generator once and links its result at the back of the list.
+ *
+ * @param list The list to append to.
+ * @return `false` if the generator returned `std::nullopt`, `true` otherwise.
+ */
+template <typename T>
+template<typename F>
+bool LazyList<T>::FunctionSource<F>::pull(LazyList& list) {
+    std::optional<T> value = generate();
+    if (!value) {
+        return false;
+    }
+    list.link_back(std::move(*value));
+    return true;
+}
+
+/**
+ * @brief Constructs a node from the given arguments and links it at the materialized frontier.
+ *
+ * @param args The arguments to construct the new element.
+ */
+template <typename T>
+template<typename... Args>
+void LazyList<T>::link_back(Args&&... args) {
+    Node* node = new Node(std::forward<Args>(args)...);
+    if (tail) {
+        tail->next = node;
+    }
+    else {
+        head = node;
+    }
+    tail = node;
+    ++materialized_count;
+}
+
+/**
+ * @brief Materializes one more element from the source.
+ *
+ * The source is released as soon as it reports exhaustion, so a finished generator's frame does
+ * not outlive its last element.
+ *
+ * @return `false` if the source is exhausted, `true` if an element was linked.
+ */
+template <typename T>
+bool LazyList<T>::pull() {
+    if (!source) {
+        return false;
+    }
+    if (!source->pull(*this)) {
+        source.reset();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Constructs a singular iterator.
+ */
+template <typename T>
+LazyList<T>::iterator::iterator() : owner(nullptr), node_ptr(nullptr) { }
+
+/**
+ * @brief Constructor for an iterator, initializing it with a node pointer.
+ *
+ * @param list The list to pull from when the iterator reaches the materialized frontier.
+ * @param ptr The node the iterator will reference, or nullptr for `end()`.
+ */
+template <typename T>
+LazyList<T>::iterator::iterator(LazyList* list, Node* ptr) : owner(list), node_ptr(ptr) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A reference to the data stored in the current node.
+ */
+template <typename T>
+typename LazyList<T>::iterator::reference LazyList<T>::iterator::operator*() const {
+    return node_ptr->data;
+}
+
+/**
+ * @brief Arrow operator for iterator.
+ *
+ * @return A pointer to the data stored in the current node.
+ */
+template <typename T>
+typename LazyList<T>::iterator::pointer LazyList<T>::iterator::operator->() const {
+    return &node_ptr->data;
+}
+
+/**
+ * @brief Prefix increment operator for iterator.
+ *
+ * Stepping off the last materialized node pulls exactly one element from the source; the
+ * iterator only becomes `end()` once the source is exhausted.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename LazyList<T>::iterator& LazyList<T>::iterator::operator++() {
+    if (!node_ptr->next) {
+        owner->pull();
+    }
+    node_ptr = node_ptr->next;
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename LazyList<T>::iterator LazyList<T>::iterator::operator++(int) {
+    iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators point to the same node, false otherwise.
+ */
+template <typename T>
+bool LazyList<T>::iterator::operator==(const iterator& other) const {
+    return node_ptr == other.node_ptr;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators point to different nodes, false otherwise.
+ */
+template <typename T>
+bool LazyList<T>::iterator::operator!=(const iterator& other) const {
+    return node_ptr != other.node_ptr;
+}
+
+/**
+ * @brief Constructs a lazy list over an input range without reading from it.
+ *
+ * An lvalue range is referenced and must outlive the list; an rvalue range, such as a
+ * `ListGenerator`, is moved into the list.
+ *
+ * @param range The range to materialize elements from.
+ */
+template <typename T>
+template<std::ranges::input_range R>
+    requires std::ranges::viewable_range<R> && std::constructible_from<T, std::ranges::range_reference_t<R>>
+LazyList<T>::LazyList(R&& range)
+    : head(nullptr), tail(nullptr),
+      source(std::make_unique<RangeSource<std::views::all_t<R>>>(std::views::all(std::forward<R>(range)))),
+      materialized_count(0) { }
+
+/**
+ * @brief Constructs a lazy list over a generating callable without calling it.
+ *
+ * @param fn Called once per element; returns the next element, or `std::nullopt` at the end.
+ */
+template <typename T>
+template<typename F>
+    requires (!std::ranges::range<F>) && std::same_as<std::invoke_result_t<F&>, std::optional<T>>
+LazyList<T>::LazyList(F fn)
+    : head(nullptr), tail(nullptr), source(std::make_unique<FunctionSource<F>>(std::move(fn))), materialized_count(0) { }
+
+/**
+ * @brief Destroys the materialized nodes and releases the source without draining it.
+ */
+template <typename T>
+LazyList<T>::~LazyList() {
+    while (head) {
+        Node* next = head->next;
+        delete head;
+        head = next;
+    }
+}
+
+/**
+ * @brief Accessor to the front element, materializing it if necessary.
+ *
+ * @return A reference to the front element.
+ * @throw std::out_of_range if the source produces no elements.
+ */
+template <typename T>
+typename LazyList<T>::reference LazyList<T>::front() {
+    if (!head && !pull()) {
+        throw std::out_of_range("List is empty");
+    }
+    return head->data;
+}
+
+/**
+ * @brief Returns an iterator to the first element, materializing it if necessary.
+ *
+ * @return An iterator to the first element, or `end()` if the source is empty.
+ */
+template <typename T>
+typename LazyList<T>::iterator LazyList<T>::begin() {
+    if (!head) {
+        pull();
+    }
+    return iterator(this, head);
+}
+
+/**
+ * @brief Returns the end iterator, which an iterator only reaches once the source is exhausted.
+ *
+ * @return The end iterator.
+ */
+template <typename T>
+typename LazyList<T>::iterator LazyList<T>::end() {
+    return iterator(this, nullptr);
+}
+
+/**
+ * @brief Materializes elements until at least `count` exist or the source is exhausted.
+ *
+ * @param count The number of elements wanted.
+ * @return The number of elements materialized afterwards.
+ */
+template <typename T>
+typename LazyList<T>::size_type LazyList<T>::materialize(size_type count) {
+    while (materialized_count < count && pull()) { }
+    return materialized_count;
+}
+
+/**
+ * @brief Returns how many elements have been pulled from the source so far, without pulling more.
+ *
+ * @return The number of materialized elements.
+ */
+template <typename T>
+typename LazyList<T>::size_type LazyList<T>::materialized() const {
+    return materialized_count;
+}
+
+/**
+ * @brief Checks whether the source has been drained.
+ *
+ * @return `true` once every element has been materialized, `false` otherwise.
+ */
+template <typename T>
+bool LazyList<T>::exhausted() const {
+    return !source;
+}
+
+/**
+ * @brief Returns the number of elements, draining the source to count them.
+ *
+ * @return The size of the list.
+ */
+template <typename T>
+typename LazyList<T>::size_type LazyList<T>::getSize() {
+    while (pull()) { }
+    return materialized_count;
+}
+
+/**
+ * @brief Checks whether the list is empty, materializing at most one element.
+ *
+ * @return `true` if the source produces no elements, `false` otherwise.
+ */
+template <typename T>
+bool LazyList<T>::empty() {
+    return !head && !pull();
+}
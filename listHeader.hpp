@@ -1,25 +1,131 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "interleavedTraversalHeader.hpp"
+#include "listKernelsHeader.hpp"
+#include "listReclaimerHeader.hpp"
+#include "nodePoolHeader.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#ifndef LIST_PREFETCH_DISTANCE
+#define LIST_PREFETCH_DISTANCE 4
+#endif
+
+#ifndef LIST_CHUNK_SIZE
+#define LIST_CHUNK_SIZE 64
+#endif
+
+#ifndef LIST_PARALLEL_COPY_GRAIN
+#define LIST_PARALLEL_COPY_GRAIN 4096
+#endif
+
+struct parallel_copy_t {
+    explicit parallel_copy_t() = default;
+};
+
+inline constexpr parallel_copy_t parallel_copy{};
 
 template <typename T>
 class List {
+    template <typename> friend class AdaptiveList;
 private:
     struct Node {
         T data;
         Node* next;
-        Node* prev;
+        std::uintptr_t prev_link;
         Node(const T&);
         template<typename... Args>
         Node(Args&&...);
+        Node* prev() const;
+        void set_prev(Node*);
+        bool erased() const;
+        void set_erased();
+#ifndef LIST_DISABLE_NODE_POOL
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+#endif
+    };
+
+    static_assert(alignof(Node) >= 2, "the erased flag is kept in the low bit of Node::prev_link");
+
+    template<std::size_t K>
+    class PrefetchWalker {
+    public:
+        static_assert(K > 0, "prefetch distance must be at least one node");
+        explicit PrefetchWalker(Node*);
+        Node* current() const;
+        Node* live();
+        void advance();
+    private:
+        Node* ring[K + 1];
+        std::size_t first;
+        std::size_t count;
+        bool exhausted;
     };
 
     Node* head;
     Node* tail;
     size_t size;
+    size_t tombstones;
+    size_t sweep_threshold;
+    size_t teardown_threshold;
+    bool hashing;
+    mutable bool hash_dirty;
+    mutable std::uint64_t rolling;
+    mutable std::uint64_t rolling_pow;
+
+    static constexpr std::uint64_t hash_modulus = (std::uint64_t(1) << 61) - 1;
+    static constexpr std::uint64_t hash_base = 0x1b873593cc9e2d51ULL % ((std::uint64_t(1) << 61) - 1);
+    static const std::uint64_t hash_base_inverse;
+
+    static void prefetch(const Node*);
+    static Node* live_forward(Node*);
+    static Node* live_backward(Node*);
+    Node* unlink_node(Node*);
+    void drop_front_tombstones();
+    void drop_back_tombstones();
+
+    static constexpr std::uint64_t hash_mul(std::uint64_t, std::uint64_t);
+    static constexpr std::uint64_t hash_add(std::uint64_t, std::uint64_t);
+    static constexpr std::uint64_t hash_sub(std::uint64_t, std::uint64_t);
+    static constexpr std::uint64_t hash_pow(std::uint64_t, std::uint64_t);
+    static std::uint64_t element_hash(const T&);
+    void hash_linked(Node*);
+    void hash_unlinking(Node*);
+    void reset_hash();
+    std::uint64_t compute_hash(std::uint64_t&) const;
+    void recompute_hash() const;
+
+    static constexpr bool gathers_chunks = std::is_trivially_copyable_v<T>;
+    static constexpr bool hashable = requires(const T& value) { std::hash<T>{}(value); };
+
+    static std::size_t fill_chunk(PrefetchWalker<LIST_PREFETCH_DISTANCE>&, T*, Node**);
+
+    template<typename F>
+    void gather_chunks(F&&) const;
+
+    static Node* copy_segment(const Node*, std::size_t, Node*&);
+    static void free_chain(Node*);
+    static void* skip_nodes(void*, std::size_t);
+    static void destroy_nodes(void*, std::size_t);
 
 public:
     class iterator;
@@ -70,6 +176,7 @@ public:
             const_iterator operator--(int);
             bool operator==(const const_iterator&) const;
             bool operator!=(const const_iterator&) const;
+            friend class List<T>;
         private:
             Node* node_ptr;
     };
@@ -116,12 +223,36 @@ public:
         Node* node_ptr;
     };
 
+    template<std::size_t K = LIST_PREFETCH_DISTANCE>
+    class prefetch_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        explicit prefetch_iterator(Node*);
+        reference operator*() const;
+        pointer operator->() const;
+        prefetch_iterator& operator++();
+        prefetch_iterator operator++(int);
+        bool operator==(const prefetch_iterator&) const;
+        bool operator!=(const prefetch_iterator&) const;
+        operator iterator() const;
+    private:
+        PrefetchWalker<K> walker;
+    };
+
     List();
+    List(const List&);
+    List(parallel_copy_t, const List&, unsigned = 0);
     ~List();
     List& operator=(List&&) noexcept;
     List& operator=(const List&);
     List& operator=(std::initializer_list<value_type>);
     void assign(size_type, const T&);
+    void assign(parallel_copy_t, const List&, unsigned = 0);
 
     template<class InputIt>
     void assign(InputIt, InputIt);
@@ -179,6 +310,13 @@ public:
     void swap(List&);
     iterator begin();
     iterator end();
+
+    template<std::size_t K = LIST_PREFETCH_DISTANCE>
+    prefetch_iterator<K> prefetch_begin();
+
+    template<std::size_t K = LIST_PREFETCH_DISTANCE>
+    prefetch_iterator<K> prefetch_end();
+
     const_iterator cbegin() const;
     const_iterator cend() const;
     reverse_iterator rbegin();
@@ -187,6 +325,53 @@ public:
     const_reverse_iterator rend() const;
     size_type getSize() const;
     bool empty();
+
+    template<typename F>
+    void for_each_chunk(F&&);
+
+    template<typename F>
+    void for_each_chunk(F&&) const;
+
+    iterator find(const T&);
+    const_iterator find(const T&) const;
+    size_type count(const T&) const;
+
+    template<std::size_t Width = INTERLEAVED_TRAVERSAL_WIDTH>
+    static void find_batch(std::span<const List* const>, std::span<const T>, std::span<const T*>);
+
+    template<std::size_t Width = INTERLEAVED_TRAVERSAL_WIDTH, typename Pred>
+    static void find_batch_if(std::span<const List* const>, std::span<const T*>, Pred);
+
+    T min() const;
+    T max() const;
+    T sum() const;
+    size_type remove(const T&);
+    iterator mark_erased(iterator);
+    size_type sweep();
+    void set_sweep_threshold(size_type);
+    size_type erased_count() const;
+    void set_deferred_teardown(size_type);
+    size_type copy_to(std::span<T>) const;
+    std::vector<T> to_vector() const;
+    void move_into(std::vector<T>&);
+    bool operator==(const List&) const;
+    auto operator<=>(const List&) const requires std::three_way_comparable<T>;
+    std::size_t hash_code() const;
+    void splice(const_iterator, List&);
+    void enable_rolling_hash();
+    void disable_rolling_hash();
+    bool rolling_hash_enabled() const;
+    std::uint64_t content_hash() const;
+    void refresh_content_hash();
+    static size_type trim(size_type);
+
+    template<typename Pred>
+    size_type remove_if(Pred);
+};
+
+template <typename T>
+struct std::hash<List<T>> {
+    std::size_t operator()(const List<T>&) const;
 };
 
 #include "listImplementation.tpp"
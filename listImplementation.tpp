@@ -3,12 +3,12 @@
 /**
  * @brief Default constructor for a list node.
  * 
- * Initializes a new node with the provided value, setting next and prev pointers to nullptr.
+ * Initializes a new live node with the provided value, setting next and prev pointers to nullptr.
  * 
  * @param value The value to store in the node.
  */
 template <typename T>
-List<T>::Node::Node(const T& value) : data(value), next(nullptr), prev(nullptr) { }
+List<T>::Node::Node(const T& value) : data(value), next(nullptr), prev_link(0) { }
 
 /**
  * @brief Variadic constructor for a list node, forwarding arguments to construct the node's data.
@@ -19,7 +19,74 @@ List<T>::Node::Node(const T& value) : data(value), next(nullptr), prev(nullptr)
  */
 template <typename T>
 template<typename... Args>
-List<T>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) { }
+List<T>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), prev_link(0) { }
+
+/**
+ * @brief Returns the previous node.
+ * 
+ * The link shares its word with the erased flag, which lives in the low bit; node alignment keeps
+ * that bit free, so tombstones cost no space in the node.
+ * 
+ * @return The previous node, or nullptr at the head.
+ */
+template <typename T>
+typename List<T>::Node* List<T>::Node::prev() const {
+    return reinterpret_cast<Node*>(prev_link & ~std::uintptr_t(1));
+}
+
+/**
+ * @brief Sets the previous node, keeping the erased flag.
+ * 
+ * @param node The new previous node, or nullptr.
+ */
+template <typename T>
+void List<T>::Node::set_prev(Node* node) {
+    prev_link = reinterpret_cast<std::uintptr_t>(node) | (prev_link & 1);
+}
+
+/**
+ * @brief Checks whether the node was marked by `mark_erased`.
+ * 
+ * @return True if the node is a tombstone.
+ */
+template <typename T>
+bool List<T>::Node::erased() const {
+    return prev_link & 1;
+}
+
+/**
+ * @brief Marks the node as a tombstone.
+ */
+template <typename T>
+void List<T>::Node::set_erased() {
+    prev_link |= 1;
+}
+
+#ifndef LIST_DISABLE_NODE_POOL
+/**
+ * @brief Allocates a node from the slab pool shared by all nodes of the same size and alignment.
+ * 
+ * Define `LIST_DISABLE_NODE_POOL` before including the header to use the global allocator instead.
+ * 
+ * @param bytes The size of the node, always `sizeof(Node)`.
+ * @return Storage for one node.
+ */
+template <typename T>
+void* List<T>::Node::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Node), alignof(Node)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a node's storage to its slab pool.
+ * 
+ * @param ptr The node storage to release.
+ */
+template <typename T>
+void List<T>::Node::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Node), alignof(Node)>::instance().deallocate(ptr);
+}
+#endif
 
 /**
  * @brief Constructor for an iterator, initializing it with a node pointer.
@@ -64,7 +131,7 @@ typename List<T>::iterator::pointer List<T>::iterator::operator->() {
  */
 template <typename T>
 typename List<T>::iterator& List<T>::iterator::operator++() {
-    node_ptr = node_ptr->next;
+    node_ptr = live_forward(node_ptr->next);
     return *this;
 }
 
@@ -78,7 +145,7 @@ typename List<T>::iterator& List<T>::iterator::operator++() {
 template <typename T>
 typename List<T>::iterator List<T>::iterator::operator++(int) {
     iterator tmp = *this;
-    node_ptr = node_ptr->next;
+    node_ptr = live_forward(node_ptr->next);
     return tmp;
 }
 
@@ -91,7 +158,7 @@ typename List<T>::iterator List<T>::iterator::operator++(int) {
  */
 template <typename T>
 typename List<T>::iterator& List<T>::iterator::operator--() {
-    node_ptr = node_ptr->prev;
+    node_ptr = live_backward(node_ptr->prev());
     return *this;
 }
 
@@ -105,7 +172,7 @@ typename List<T>::iterator& List<T>::iterator::operator--() {
 template <typename T>
 typename List<T>::iterator List<T>::iterator::operator--(int) {
     iterator tmp = *this;
-    node_ptr = node_ptr->prev;
+    node_ptr = live_backward(node_ptr->prev());
     return tmp;
 }
 
@@ -178,7 +245,7 @@ typename List<T>::const_iterator::pointer List<T>::const_iterator::operator->()
  */
 template <typename T>
 typename List<T>::const_iterator& List<T>::const_iterator::operator++() {
-    node_ptr = node_ptr->next;
+    node_ptr = live_forward(node_ptr->next);
     return *this;
 }
 
@@ -192,7 +259,7 @@ typename List<T>::const_iterator& List<T>::const_iterator::operator++() {
 template <typename T>
 typename List<T>::const_iterator List<T>::const_iterator::operator++(int) {
     typename List<T>::const_iterator tmp = *this;
-    node_ptr = node_ptr->next;
+    node_ptr = live_forward(node_ptr->next);
     return tmp;
 }
 
@@ -205,7 +272,7 @@ typename List<T>::const_iterator List<T>::const_iterator::operator++(int) {
  */
 template <typename T>
 typename List<T>::const_iterator& List<T>::const_iterator::operator--() {
-    node_ptr = node_ptr->prev;
+    node_ptr = live_backward(node_ptr->prev());
     return *this;
 }
 
@@ -219,7 +286,7 @@ typename List<T>::const_iterator& List<T>::const_iterator::operator--() {
 template <typename T>
 typename List<T>::const_iterator List<T>::const_iterator::operator--(int) {
     typename List<T>::const_iterator tmp = *this;
-    node_ptr = node_ptr->prev;
+    node_ptr = live_backward(node_ptr->prev());
     return tmp;
 }
 
@@ -292,7 +359,7 @@ typename List<T>::reverse_iterator::pointer List<T>::reverse_iterator::operator-
  */
 template <typename T>
 typename List<T>::reverse_iterator& List<T>::reverse_iterator::operator++() {
-    node_ptr = node_ptr->prev;
+    node_ptr = live_backward(node_ptr->prev());
     return *this;
 }
 
@@ -306,7 +373,7 @@ typename List<T>::reverse_iterator& List<T>::reverse_iterator::operator++() {
 template <typename T>
 typename List<T>::reverse_iterator List<T>::reverse_iterator::operator++(int) {
     reverse_iterator tmp = *this;
-    node_ptr = node_ptr->prev;
+    node_ptr = live_backward(node_ptr->prev());
     return tmp;
 }
 
@@ -319,7 +386,7 @@ typename List<T>::reverse_iterator List<T>::reverse_iterator::operator++(int) {
  */
 template <typename T>
 typename List<T>::reverse_iterator& List<T>::reverse_iterator::operator--() {
-    node_ptr = node_ptr->next;
+    node_ptr = live_forward(node_ptr->next);
     return *this;
 }
 
@@ -333,7 +400,7 @@ typename List<T>::reverse_iterator& List<T>::reverse_iterator::operator--() {
 template <typename T>
 typename List<T>::reverse_iterator List<T>::reverse_iterator::operator--(int) {
     reverse_iterator tmp = *this;
-    node_ptr = node_ptr->next;
+    node_ptr = live_forward(node_ptr->next);
     return tmp;
 }
 
@@ -363,14 +430,308 @@ bool List<T>::reverse_iterator::operator!=(const reverse_iterator& other) const
     return node_ptr != other.node_ptr;
 }
 
+/**
+ * @brief Issues a software prefetch for a node so that a later access to it does not stall.
+ * 
+ * The hint is a no-op on compilers without a prefetch intrinsic and for null pointers.
+ * 
+ * @param node The node that will be visited soon.
+ */
+template <typename T>
+void List<T>::prefetch(const Node* node) {
+    if (!node) {
+        return;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(node);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(reinterpret_cast<const char*>(node), _MM_HINT_T0);
+#endif
+}
+
+/**
+ * @brief Returns the first live node at or after the given node.
+ * 
+ * Nodes marked by `mark_erased` stay linked until the next sweep; iteration skips over them.
+ * 
+ * @param node The node to start from.
+ * @return The first node that is not marked as erased, or nullptr.
+ */
+template <typename T>
+typename List<T>::Node* List<T>::live_forward(Node* node) {
+    while (node && node->erased()) {
+        node = node->next;
+    }
+    return node;
+}
+
+/**
+ * @brief Returns the first live node at or before the given node.
+ * 
+ * @param node The node to start from.
+ * @return The closest preceding node that is not marked as erased, or nullptr.
+ */
+template <typename T>
+typename List<T>::Node* List<T>::live_backward(Node* node) {
+    while (node && node->erased()) {
+        node = node->prev();
+    }
+    return node;
+}
+
+/**
+ * @brief Unlinks and frees the marked nodes sitting at the front of the list.
+ * 
+ * Called before removing from the front so that `pop_front` always removes a live element.
+ */
+template <typename T>
+void List<T>::drop_front_tombstones() {
+    while (head && head->erased()) {
+        Node* temp = head;
+        head = head->next;
+        if (head) {
+            head->set_prev(nullptr);
+        }
+        else {
+            tail = nullptr;
+        }
+        delete temp;
+        --tombstones;
+    }
+}
+
+/**
+ * @brief Unlinks and frees the marked nodes sitting at the back of the list.
+ * 
+ * Called before removing from the back so that `pop_back` always removes a live element.
+ */
+template <typename T>
+void List<T>::drop_back_tombstones() {
+    while (tail && tail->erased()) {
+        Node* temp = tail;
+        tail = tail->prev();
+        if (tail) {
+            tail->next = nullptr;
+        }
+        else {
+            head = nullptr;
+        }
+        delete temp;
+        --tombstones;
+    }
+}
+
+/**
+ * @brief Constructs a prefetching walker starting at the given node.
+ * 
+ * The walker keeps a ring of the next `K + 1` nodes, so the node being processed is `K` hops
+ * behind the newest one. Every step still loads the `next` pointer of that newest node, so the
+ * chain stays serially dependent and at most one miss is outstanding per list. What the ring buys
+ * is lead distance: the work done on the current node (a compare, a copy, a destructor) runs
+ * while the single miss further down the chain resolves. Overlapping several misses needs
+ * several independent chains, which is what `InterleavedTraversal` and `find_batch` provide.
+ * 
+ * @param start The first node to visit, or nullptr for an empty walk.
+ */
+template <typename T>
+template <std::size_t K>
+List<T>::PrefetchWalker<K>::PrefetchWalker(Node* start) : ring{}, first(0), count(0), exhausted(start == nullptr) {
+    Node* node = start;
+    while (node && count <= K) {
+        prefetch(node);
+        ring[count++] = node;
+        node = (count <= K) ? node->next : node;
+    }
+    if (count <= K) {
+        exhausted = true;
+    }
+}
+
+/**
+ * @brief Returns the node the walker currently points to.
+ * 
+ * @return The current node, or nullptr once the walk has passed the last node.
+ */
+template <typename T>
+template <std::size_t K>
+typename List<T>::Node* List<T>::PrefetchWalker<K>::current() const {
+    return count ? ring[first] : nullptr;
+}
+
+/**
+ * @brief Moves the walker past any nodes marked as erased.
+ * 
+ * @return The current live node, or nullptr once the walk is finished.
+ */
+template <typename T>
+template <std::size_t K>
+typename List<T>::Node* List<T>::PrefetchWalker<K>::live() {
+    while (current() && current()->erased()) {
+        advance();
+    }
+    return current();
+}
+
+/**
+ * @brief Moves the walker to the next node, prefetching the node `K` hops ahead.
+ * 
+ * The `next` pointer of the current node is never needed after this call, so the caller may
+ * delete the node it just left.
+ */
+template <typename T>
+template <std::size_t K>
+void List<T>::PrefetchWalker<K>::advance() {
+    if (!count) {
+        return;
+    }
+    Node* back = ring[(first + count - 1) % (K + 1)];
+    first = (first + 1) % (K + 1);
+    --count;
+    if (!exhausted) {
+        Node* ahead = back->next;
+        if (ahead) {
+            prefetch(ahead);
+            ring[(first + count) % (K + 1)] = ahead;
+            ++count;
+        }
+        else {
+            exhausted = true;
+        }
+    }
+}
+
+/**
+ * @brief Constructs a prefetching iterator starting at the given node.
+ * 
+ * @param ptr The node the iterator will reference first.
+ */
+template <typename T>
+template <std::size_t K>
+List<T>::prefetch_iterator<K>::prefetch_iterator(Node* ptr) : walker(ptr) {
+    while (walker.current() && walker.current()->erased()) {
+        walker.advance();
+    }
+}
+
+/**
+ * @brief Dereference operator for the prefetching iterator.
+ * 
+ * @return A reference to the data stored in the current node.
+ */
+template <typename T>
+template <std::size_t K>
+typename List<T>::template prefetch_iterator<K>::reference List<T>::prefetch_iterator<K>::operator*() const {
+    return walker.current()->data;
+}
+
+/**
+ * @brief Arrow operator for the prefetching iterator.
+ * 
+ * @return A pointer to the data stored in the current node.
+ */
+template <typename T>
+template <std::size_t K>
+typename List<T>::template prefetch_iterator<K>::pointer List<T>::prefetch_iterator<K>::operator->() const {
+    return &walker.current()->data;
+}
+
+/**
+ * @brief Prefix increment for the prefetching iterator, moving to the next node.
+ * 
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+template <std::size_t K>
+typename List<T>::template prefetch_iterator<K>& List<T>::prefetch_iterator<K>::operator++() {
+    do {
+        walker.advance();
+    } while (walker.current() && walker.current()->erased());
+    return *this;
+}
+
+/**
+ * @brief Postfix increment for the prefetching iterator.
+ * 
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+template <std::size_t K>
+typename List<T>::template prefetch_iterator<K> List<T>::prefetch_iterator<K>::operator++(int) {
+    prefetch_iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison for prefetching iterators, checking if both point to the same node.
+ * 
+ * @param other The iterator to compare against.
+ * @return true if the iterators are equal, false otherwise.
+ */
+template <typename T>
+template <std::size_t K>
+bool List<T>::prefetch_iterator<K>::operator==(const prefetch_iterator& other) const {
+    return walker.current() == other.walker.current();
+}
+
+/**
+ * @brief Inequality comparison for prefetching iterators.
+ * 
+ * @param other The iterator to compare against.
+ * @return true if the iterators point to different nodes, false otherwise.
+ */
+template <typename T>
+template <std::size_t K>
+bool List<T>::prefetch_iterator<K>::operator!=(const prefetch_iterator& other) const {
+    return walker.current() != other.walker.current();
+}
+
+/**
+ * @brief Converts the prefetching iterator to a plain iterator at the same position.
+ * 
+ * This allows a position found during a prefetching scan to be passed to `insert` or `erase`.
+ * 
+ * @return An iterator pointing to the current node.
+ */
+template <typename T>
+template <std::size_t K>
+List<T>::prefetch_iterator<K>::operator iterator() const {
+    return iterator(walker.current());
+}
+
 /**
  * @brief Constructs an empty list.
  * 
  * This constructor initializes the list with no elements. Both `head` and `tail` are set to `nullptr`, 
- * and the size of the list is set to zero.
+ * and the size of the list is set to zero. Tombstones are only swept explicitly until a threshold is set.
+ */
+template <typename T>
+List<T>::List() : head(nullptr), tail(nullptr), size(0), tombstones(0), sweep_threshold(0), teardown_threshold(0),
+    hashing(false), hash_dirty(false), rolling(0), rolling_pow(1) { }
+
+/**
+ * @brief Copy constructor, performing a deep copy of the live elements of another list.
+ * 
+ * @param other The list to copy from.
+ */
+template <typename T>
+List<T>::List(const List<T>& other) : List() {
+    *this = other;
+}
+
+/**
+ * @brief Copy constructor that copy-constructs the elements on several threads.
+ * 
+ * See `assign(parallel_copy_t, const List&, unsigned)` for how the work is split.
+ * 
+ * @param tag Selects the parallel copy; pass `parallel_copy`.
+ * @param other The list to copy from.
+ * @param threads The maximum number of threads to use, or 0 for the hardware concurrency.
  */
 template <typename T>
-List<T>::List() : head(nullptr), tail(nullptr), size(0) { }
+List<T>::List(parallel_copy_t tag, const List<T>& other, unsigned threads) : List() {
+    assign(tag, other, threads);
+}
 
 /**
  * @brief Destroys the list and frees all allocated memory.
@@ -400,10 +761,14 @@ List<T>& List<T>::operator=(List<T>&& other) noexcept {
         head = other.head;
         tail = other.tail;
         size = other.size;
+        tombstones = other.tombstones;
+        hash_dirty = hashing;
 
         other.head = nullptr;
         other.tail = nullptr;
         other.size = 0;
+        other.tombstones = 0;
+        other.reset_hash();
     }
     return *this;
 }
@@ -412,7 +777,8 @@ List<T>& List<T>::operator=(List<T>&& other) noexcept {
  * @brief Copy assignment operator for the List class, copying elements from another List.
  * 
  * This operator clears the current list and copies elements from the given `other` list.
- * It prevents self-assignment and performs a deep copy of the elements.
+ * It prevents self-assignment and performs a deep copy of the elements, prefetching the
+ * source nodes ahead of the copy.
  * 
  * @param other The List object to copy from.
  * @return A reference to the current List object after the copy.
@@ -421,13 +787,203 @@ template <typename T>
 List<T>& List<T>::operator=(const List<T>& other) {
     if (this != &other) {
         clear();
-        for (Node* current = other.head; current; current = current->next) {
-            push_back(current->data);
+        for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(other.head); walker.current(); walker.advance()) {
+            if (!walker.current()->erased()) {
+                push_back(walker.current()->data);
+            }
         }
     }
     return *this;
 }
 
+/**
+ * @brief Copy-constructs a run of live elements into a new, detached node chain.
+ * 
+ * If an element's copy constructor throws, the nodes built so far are freed before the
+ * exception propagates.
+ * 
+ * @param source The first node of the run; tombstoned nodes are skipped.
+ * @param count The number of live elements to copy.
+ * @param last Receives the last node of the new chain.
+ * @return The first node of the new chain, or nullptr if `count` is zero.
+ */
+template <typename T>
+typename List<T>::Node* List<T>::copy_segment(const Node* source, std::size_t count, Node*& last) {
+    Node* first = nullptr;
+    last = nullptr;
+    try {
+        for (; count; source = source->next) {
+            if (source->erased()) {
+                continue;
+            }
+            Node* node = new Node(source->data);
+            node->set_prev(last);
+            if (last) {
+                last->next = node;
+            }
+            else {
+                first = node;
+            }
+            last = node;
+            --count;
+        }
+    }
+    catch (...) {
+        free_chain(first);
+        throw;
+    }
+    return first;
+}
+
+/**
+ * @brief Frees a detached node chain.
+ * 
+ * @param node The first node of the chain, or nullptr.
+ */
+template <typename T>
+void List<T>::free_chain(Node* node) {
+    while (node) {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+/**
+ * @brief Steps over a number of nodes of a detached chain.
+ * 
+ * Used by `ListReclaimer` to cut a retired chain into segments; only `next` is read.
+ * 
+ * @param node The first node, as an untyped pointer.
+ * @param count The number of nodes to step over; the chain must hold more than `count` nodes.
+ * @return The node `count` hops after `node`.
+ */
+template <typename T>
+void* List<T>::skip_nodes(void* node, std::size_t count) {
+    Node* current = static_cast<Node*>(node);
+    while (count--) {
+        current = current->next;
+    }
+    return current;
+}
+
+/**
+ * @brief Destroys a number of nodes of a detached chain.
+ * 
+ * The `next` pointer of the last destroyed node is not followed, so the rest of the chain may be
+ * destroyed concurrently by another thread.
+ * 
+ * @param node The first node, as an untyped pointer.
+ * @param count The number of nodes to destroy.
+ */
+template <typename T>
+void List<T>::destroy_nodes(void* node, std::size_t count) {
+    Node* current = static_cast<Node*>(node);
+    while (count--) {
+        Node* next = count ? current->next : nullptr;
+        if (count > 1) {
+            prefetch(next->next);
+        }
+        delete current;
+        current = next;
+    }
+}
+
+/**
+ * @brief Replaces the contents with a copy of another list, copy-constructing the elements on several threads.
+ * 
+ * Worth it when copying `T` is expensive (strings, nested containers). A single prefetching walk
+ * over `other` records where each segment of about equal length starts; every worker then
+ * copy-constructs its segment into a detached node chain, with the calling thread taking the first
+ * segment, and the chains are stitched together in order. Lists shorter than two
+ * `LIST_PARALLEL_COPY_GRAIN` segments are copied on the calling thread.
+ * 
+ * The current contents are only released once every segment has been copied, so if any element's
+ * copy constructor throws, the exception is rethrown after all workers have finished and the list
+ * is left unchanged.
+ * 
+ * @param tag Selects the parallel copy; pass `parallel_copy`.
+ * @param other The list to copy from.
+ * @param threads The maximum number of threads to use, or 0 for the hardware concurrency.
+ */
+template <typename T>
+void List<T>::assign(parallel_copy_t, const List<T>& other, unsigned threads) {
+    if (this == &other) {
+        return;
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::size_t segments = std::min<std::size_t>(threads, other.size / LIST_PARALLEL_COPY_GRAIN);
+    if (segments < 2) {
+        *this = other;
+        return;
+    }
+
+    std::vector<const Node*> starts(segments);
+    std::vector<std::size_t> counts(segments);
+    std::size_t index = 0;
+    std::size_t segment = 0;
+    for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(other.head); walker.current() && segment < segments; walker.advance()) {
+        if (walker.current()->erased()) {
+            continue;
+        }
+        if (index == segment * other.size / segments) {
+            starts[segment++] = walker.current();
+        }
+        ++index;
+    }
+    for (std::size_t k = 0; k < segments; ++k) {
+        counts[k] = (k + 1) * other.size / segments - k * other.size / segments;
+    }
+
+    std::vector<Node*> firsts(segments, nullptr);
+    std::vector<Node*> lasts(segments, nullptr);
+    std::vector<std::exception_ptr> errors(segments);
+    auto copy = [&](std::size_t k) {
+        try {
+            firsts[k] = copy_segment(starts[k], counts[k], lasts[k]);
+        }
+        catch (...) {
+            errors[k] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(segments - 1);
+    try {
+        for (std::size_t k = 1; k < segments; ++k) {
+            workers.emplace_back(copy, k);
+        }
+    }
+    catch (...) {
+        for (std::size_t k = workers.size() + 1; k < segments; ++k) {
+            errors[k] = std::current_exception();
+        }
+    }
+    copy(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (std::size_t k = 0; k < segments; ++k) {
+        if (errors[k]) {
+            for (Node* first : firsts) {
+                free_chain(first);
+            }
+            std::rethrow_exception(errors[k]);
+        }
+    }
+    for (std::size_t k = 1; k < segments; ++k) {
+        lasts[k - 1]->next = firsts[k];
+        firsts[k]->set_prev(lasts[k - 1]);
+    }
+    clear();
+    head = firsts.front();
+    tail = lasts.back();
+    size = other.size;
+    hash_dirty = hashing;
+}
+
 /**
  * @brief Assignment operator for the List class using an initializer list.
  * 
@@ -504,10 +1060,11 @@ void List<T>::assign(std::initializer_list<typename List<T>::value_type> ilist)
  */
 template <typename T>
 typename List<T>::reference List<T>::front() {
-    if (!head) {
+    Node* first = live_forward(head);
+    if (!first) {
         throw std::out_of_range("List is empty");
     }
-    return head->data;
+    return first->data;
 }
 
 /**
@@ -521,10 +1078,11 @@ typename List<T>::reference List<T>::front() {
  */
 template <typename T>
 typename List<T>::const_reference List<T>::front() const {
-    if (!head) {
+    Node* first = live_forward(head);
+    if (!first) {
         throw std::out_of_range("List is empty");
     }
-    return head->data;
+    return first->data;
 }
 
 /**
@@ -538,10 +1096,11 @@ typename List<T>::const_reference List<T>::front() const {
  */
 template <typename T>
 typename List<T>::reference List<T>::back() {
-    if (!tail) {
+    Node* last = live_backward(tail);
+    if (!last) {
         throw std::out_of_range("List is empty");
     }
-    return tail->data;
+    return last->data;
 }
 
 /**
@@ -555,27 +1114,39 @@ typename List<T>::reference List<T>::back() {
  */
 template <typename T>
 typename List<T>::const_reference List<T>::back() const {
-    if (!tail) {
+    Node* last = live_backward(tail);
+    if (!last) {
         throw std::out_of_range("List is empty");
     }
-    return tail->data;
+    return last->data;
 }
 
 /**
  * @brief Clears the list, deleting all nodes.
  * 
  * This function deallocates all the nodes in the list, effectively making it empty.
+ * Nodes are walked with a `LIST_PREFETCH_DISTANCE`-deep lookahead ring, so each node's destructor
+ * and deallocation run while the next pointer further down the chain is being fetched. The walk
+ * is still one dependent chain, so a cold list costs about one miss per node. With deferred teardown enabled
+ * and at least that many nodes linked, the chain is handed to `ListReclaimer` in O(1) instead.
  */
 template <typename T>
 void List<T>::clear() {
-    Node* current = head;
-    while (current) {
-        Node* tmp = current->next;
-        delete current;
-        current = tmp;
+    std::size_t nodes = size + tombstones;
+    if (teardown_threshold && nodes >= teardown_threshold) {
+        ListReclaimer::instance().retire({head, nodes, &List<T>::skip_nodes, &List<T>::destroy_nodes});
+    }
+    else {
+        PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head);
+        while (Node* current = walker.current()) {
+            walker.advance();
+            delete current;
+        }
     }
     head = tail = nullptr;
     size = 0;
+    tombstones = 0;
+    reset_hash();
 }
 
 /**
@@ -593,10 +1164,11 @@ void List<T>::push_back(const T& value) {
     }
     else {
         tail->next = new_node;
-        new_node->prev = tail;
+        new_node->set_prev(tail);
         tail = new_node;
     }
     ++size;
+    hash_linked(new_node);
 }
 
 /**
@@ -618,24 +1190,25 @@ typename List<T>::iterator List<T>::insert(typename List<T>::const_iterator pos,
         }
         else {
             tail->next = new_node;
-            new_node->prev = tail;
+            new_node->set_prev(tail);
             tail = new_node;
         }
     }
     else {
         if (current == head) {
             new_node->next = head;
-            head->prev = new_node;
+            head->set_prev(new_node);
             head = new_node;
         }
         else {
             new_node->next = current;
-            new_node->prev = current->prev;
-            current->prev->next = new_node;
-            current->prev = new_node;
+            new_node->set_prev(current->prev());
+            current->prev()->next = new_node;
+            current->set_prev(new_node);
         }
     }
     ++size;
+    hash_linked(new_node);
     return typename List<T>::iterator(new_node);
 }
 
@@ -658,24 +1231,25 @@ typename List<T>::iterator List<T>::insert(typename List<T>::const_iterator pos,
         }
         else {
             tail->next = new_node;
-            new_node->prev = tail;
+            new_node->set_prev(tail);
             tail = new_node;
         }
     }
     else {
         if (current == head) {
             new_node->next = head;
-            head->prev = new_node;
+            head->set_prev(new_node);
             head = new_node;
         }
         else {
             new_node->next = current;
-            new_node->prev = current->prev;
-            current->prev->next = new_node;
-            current->prev = new_node;
+            new_node->set_prev(current->prev());
+            current->prev()->next = new_node;
+            current->set_prev(new_node);
         }
     }
     ++size;
+    hash_linked(new_node);
     return typename List<T>::iterator(new_node);
 }
 
@@ -758,24 +1332,25 @@ typename List<T>::iterator List<T>::insert(typename List<T>::iterator pos, T& va
         }
         else {
             tail->next = new_node;
-            new_node->prev = tail;
+            new_node->set_prev(tail);
             tail = new_node;
         }
     }
     else {
         if (current == head) {
             new_node->next = head;
-            head->prev = new_node;
+            head->set_prev(new_node);
             head = new_node;
         }
         else {
             new_node->next = current;
-            new_node->prev = current->prev;
-            current->prev->next = new_node;
-            current->prev = new_node;
+            new_node->set_prev(current->prev());
+            current->prev()->next = new_node;
+            current->set_prev(new_node);
         }
     }
     ++size;
+    hash_linked(new_node);
     return typename List<T>::iterator(new_node);
 }
 
@@ -801,24 +1376,25 @@ typename List<T>::iterator List<T>::insert(typename List<T>::iterator pos, T&& v
         }
         else {
             tail->next = new_node;
-            new_node->prev = tail;
+            new_node->set_prev(tail);
             tail = new_node;
         }
     }
     else {
         if (current == head) {
             new_node->next = head;
-            head->prev = new_node;
+            head->set_prev(new_node);
             head = new_node;
         }
         else {
             new_node->next = current;
-            new_node->prev = current->prev;
-            current->prev->next = new_node;
-            current->prev = new_node;
+            new_node->set_prev(current->prev());
+            current->prev()->next = new_node;
+            current->set_prev(new_node);
         }
     }
     ++size;
+    hash_linked(new_node);
     return typename List<T>::iterator(new_node);
 }
 
@@ -902,63 +1478,82 @@ typename List<T>::iterator List<T>::emplace(typename List<T>::const_iterator pos
         }
         else {
             tail->next = new_node;
-            new_node->prev = tail;
+            new_node->set_prev(tail);
             tail = new_node;
         }
     }
     else {
         if (current == head) {
             new_node->next = head;
-            head->prev = new_node;
+            head->set_prev(new_node);
             head = new_node;
         }
         else {
             new_node->next = current;
-            new_node->prev = current->prev;
-            current->prev->next = new_node;
-            current->prev = new_node;
+            new_node->set_prev(current->prev());
+            current->prev()->next = new_node;
+            current->set_prev(new_node);
         }
     }
     ++size;
+    hash_linked(new_node);
     return typename List<T>::iterator(new_node);
 }
 
 /**
- * @brief Removes the element at the specified iterator position from the list.
+ * @brief Unlinks and frees one node, live or marked by `mark_erased`.
  * 
- * This function deletes the node at the position specified by the iterator and adjusts the list 
- * accordingly.
- * 
- * @param pos The iterator position to remove.
- * @return An iterator pointing to the next node after the removed element.
+ * @param current The node to remove.
+ * @return The node that followed it, which may itself be marked, or nullptr.
  */
 template <typename T>
-typename List<T>::iterator List<T>::erase(typename List<T>::iterator pos) {
-    typename List<T>::Node* current = pos.node_ptr;
-    if (!current) {
-        return end();
+typename List<T>::Node* List<T>::unlink_node(Node* current) {
+    Node* next_node = current->next;
+    if (!current->erased()) {
+        hash_unlinking(current);
     }
-    typename List<T>::Node* next_node = current->next;
 
     if (current == head) {
         head = current->next;
-        if (head) head->prev = nullptr;
+        if (head) head->set_prev(nullptr);
         else tail = nullptr;
     }
     else if (current == tail) {
-        tail = tail->prev;
+        tail = tail->prev();
         if (tail) tail->next = nullptr;
         else head = nullptr;
     }
     else {
-        current->prev->next = current->next;
-        current->next->prev = current->prev;
+        current->prev()->next = current->next;
+        current->next->set_prev(current->prev());
     }
 
+    if (current->erased()) {
+        --tombstones;
+    }
+    else {
+        --size;
+    }
     delete current;
-    --size;
+    return next_node;
+}
 
-    return typename List<T>::iterator(next_node);
+/**
+ * @brief Removes the element at the specified iterator position from the list.
+ * 
+ * This function deletes the node at the position specified by the iterator and adjusts the list 
+ * accordingly.
+ * 
+ * @param pos The iterator position to remove.
+ * @return An iterator pointing to the next node after the removed element.
+ */
+template <typename T>
+typename List<T>::iterator List<T>::erase(typename List<T>::iterator pos) {
+    typename List<T>::Node* current = pos.node_ptr;
+    if (!current) {
+        return end();
+    }
+    return typename List<T>::iterator(live_forward(unlink_node(current)));
 }
 
 /**
@@ -979,7 +1574,8 @@ typename List<T>::iterator List<T>::erase(const_iterator pos) {
  * @brief Removes elements in the range [first, last) from the list.
  * 
  * This function removes nodes from the list, starting from the iterator 'first' up to (but not including)
- * the iterator 'last'.
+ * the iterator 'last'. The walk follows raw links, so nodes marked by `mark_erased` inside the range
+ * are freed too and a `last` that is itself marked is still reached.
  * 
  * @param first The starting iterator of the range to remove.
  * @param last The ending iterator of the range to remove.
@@ -987,10 +1583,11 @@ typename List<T>::iterator List<T>::erase(const_iterator pos) {
  */
 template <typename T>
 typename List<T>::iterator List<T>::erase(typename List<T>::iterator first, typename List<T>::iterator last) {
-    while (first != last) {
-        first = erase(first);
+    Node* current = first.node_ptr;
+    while (current != last.node_ptr) {
+        current = unlink_node(current);
     }
-    return last;
+    return typename List<T>::iterator(live_forward(current));
 }
 
 /**
@@ -1005,10 +1602,8 @@ typename List<T>::iterator List<T>::erase(typename List<T>::iterator first, type
  */
 template <typename T>
 typename List<T>::iterator List<T>::erase(typename List<T>::const_iterator first, typename List<T>::const_iterator last) {
-    while (first != last) {
-        first = erase(typename List<T>::iterator(const_cast<typename List<T>::Node*>(first.node_ptr)));
-    }
-    return last;
+    return erase(typename List<T>::iterator(const_cast<typename List<T>::Node*>(first.node_ptr)),
+                 typename List<T>::iterator(const_cast<typename List<T>::Node*>(last.node_ptr)));
 }
 
 /**
@@ -1029,10 +1624,11 @@ typename List<T>::reference List<T>::emplace_back(Args&&... args) {
     }
     else {
         tail->next = new_node;
-        new_node->prev = tail;
+        new_node->set_prev(tail);
         tail = new_node;
     }
     ++size;
+    hash_linked(new_node);
     return new_node->data;
 }
 
@@ -1056,16 +1652,19 @@ void List<T>::append_range(R&& rg) {
  * @brief Removes the last element from the list.
  * 
  * This function removes the last node from the list and adjusts the list accordingly. 
+ * Tombstones left at the back by `mark_erased` are freed first.
  * If the list becomes empty, both head and tail are set to null.
  */
 template <typename T>
 void List<T>::pop_back() {
+    drop_back_tombstones();
     if (!head) {
         return; 
     }
+    hash_unlinking(tail);
 
     typename List<T>::Node* temp = tail;
-    tail = tail->prev;
+    tail = tail->prev();
 
     if (tail) {
         tail->next = nullptr;
@@ -1091,11 +1690,12 @@ void List<T>::push_front(const T& value) {
         head = tail = new_node;
     }
     else {
-        head->prev = new_node;
+        head->set_prev(new_node);
         new_node->next = head;
         head = new_node;
     }
     ++size;
+    hash_linked(new_node);
 }
 
 /**
@@ -1112,11 +1712,12 @@ void List<T>::push_front(T&& value) {
         head = tail = new_node;
     }
     else {
-        head->prev = new_node;
+        head->set_prev(new_node);
         new_node->next = head;
         head = new_node;
     }
     ++size;
+    hash_linked(new_node);
 }
 
 /**
@@ -1152,11 +1753,12 @@ typename List<T>::reference List<T>::emplace_front(Args&&... args) {
         head = tail = new_node;
     }
     else {
-        head->prev = new_node;
+        head->set_prev(new_node);
         new_node->next = head;
         head = new_node;
     }
     ++size;
+    hash_linked(new_node);
     return new_node->data;
 }
 
@@ -1164,19 +1766,22 @@ typename List<T>::reference List<T>::emplace_front(Args&&... args) {
  * @brief Removes the first element from the list.
  * 
  * This function removes the first node from the list and adjusts the list accordingly. 
+ * Tombstones left at the front by `mark_erased` are freed first.
  * If the list becomes empty, both head and tail are set to null.
  */
 template <typename T>
 void List<T>::pop_front() {
+    drop_front_tombstones();
     if (!head) {
         return; 
     }
+    hash_unlinking(head);
 
     typename List<T>::Node* temp = head;
     head = head->next;
 
     if (head) {
-        head->prev = nullptr;
+        head->set_prev(nullptr);
     } else {
         tail = nullptr; 
     }
@@ -1246,6 +1851,11 @@ void List<T>::swap(List<T>& other) {
     swap(head, other.head);
     swap(tail, other.tail);
     swap(size, other.size);
+    swap(tombstones, other.tombstones);
+    swap(hashing, other.hashing);
+    swap(hash_dirty, other.hash_dirty);
+    swap(rolling, other.rolling);
+    swap(rolling_pow, other.rolling_pow);
 }
 
 /**
@@ -1257,7 +1867,7 @@ void List<T>::swap(List<T>& other) {
  */
 template <typename T>
 typename List<T>::iterator List<T>::begin() {
-    return typename List<T>::iterator(head);
+    return typename List<T>::iterator(live_forward(head));
 }
 
 /**
@@ -1272,6 +1882,34 @@ typename List<T>::iterator List<T>::end() {
     return typename List<T>::iterator(nullptr);
 }
 
+/**
+ * @brief Returns a prefetching iterator pointing to the first element in the list.
+ * 
+ * The iterator issues a software prefetch for the node `K` hops ahead on every increment, so the
+ * caller's per-element work runs while that node is being fetched. The chain itself is still
+ * walked one dependent load at a time.
+ * 
+ * @tparam K The prefetch distance in nodes.
+ * @return A prefetching iterator pointing to the first element in the list.
+ */
+template <typename T>
+template <std::size_t K>
+typename List<T>::template prefetch_iterator<K> List<T>::prefetch_begin() {
+    return prefetch_iterator<K>(head);
+}
+
+/**
+ * @brief Returns a prefetching iterator pointing past the last element in the list.
+ * 
+ * @tparam K The prefetch distance in nodes.
+ * @return A prefetching iterator pointing past the last element in the list.
+ */
+template <typename T>
+template <std::size_t K>
+typename List<T>::template prefetch_iterator<K> List<T>::prefetch_end() {
+    return prefetch_iterator<K>(nullptr);
+}
+
 /**
  * @brief Returns a constant iterator pointing to the first element in the list.
  * 
@@ -1282,7 +1920,7 @@ typename List<T>::iterator List<T>::end() {
  */
 template <typename T>
 typename List<T>::const_iterator List<T>::cbegin() const {
-    return typename List<T>::const_iterator(head);
+    return typename List<T>::const_iterator(live_forward(head));
 }
 
 /**
@@ -1307,7 +1945,7 @@ typename List<T>::const_iterator List<T>::cend() const {
  */
 template <typename T>
 typename List<T>::const_reverse_iterator List<T>::rbegin() const {
-    return typename List<T>::reverse_iterator(tail); 
+    return typename List<T>::reverse_iterator(live_backward(tail));
 }
 
 /**
@@ -1331,7 +1969,7 @@ typename List<T>::const_reverse_iterator List<T>::rend() const {
  */
 template <typename T>
 typename List<T>::reverse_iterator List<T>::rbegin() {
-    return typename List<T>::reverse_iterator(tail); 
+    return typename List<T>::reverse_iterator(live_backward(tail));
 }
 
 /**
@@ -1369,3 +2007,1014 @@ template <typename T>
 bool List<T>::empty() {
     return begin() == end();
 }
+
+/**
+ * @brief Copies the next run of live elements from a walker into a contiguous buffer.
+ * 
+ * At most `LIST_CHUNK_SIZE` elements are copied; marked nodes are skipped. Only used for
+ * trivially copyable `T`.
+ * 
+ * @param walker The walker to pull nodes from; it is left on the first node not copied.
+ * @param values Output buffer with room for `LIST_CHUNK_SIZE` elements.
+ * @param nodes Optional output buffer receiving the node of each copied element, or nullptr.
+ * @return The number of elements copied; zero once the walk is finished.
+ */
+template <typename T>
+std::size_t List<T>::fill_chunk(PrefetchWalker<LIST_PREFETCH_DISTANCE>& walker, T* values, Node** nodes) {
+    size_type n = 0;
+    while (n < LIST_CHUNK_SIZE && walker.current()) {
+        Node* current = walker.current();
+        walker.advance();
+        if (current->erased()) {
+            continue;
+        }
+        std::memcpy(static_cast<void*>(values + n), std::addressof(current->data), sizeof(T));
+        if (nodes) {
+            nodes[n] = current;
+        }
+        ++n;
+    }
+    return n;
+}
+
+/**
+ * @brief Copies the list into fixed-size contiguous chunks and hands each chunk to a callback.
+ * 
+ * Up to `LIST_CHUNK_SIZE` elements are gathered into a stack buffer, together with the nodes they
+ * came from, while the nodes further ahead are prefetched. Only used for trivially copyable `T`.
+ * 
+ * @param fn Callable as `fn(const T* values, Node* const* nodes, size_type n)`, returning false to stop.
+ */
+template <typename T>
+template<typename F>
+void List<T>::gather_chunks(F&& fn) const {
+    alignas(T) unsigned char storage[sizeof(T) * LIST_CHUNK_SIZE];
+    T* values = std::launder(reinterpret_cast<T*>(storage));
+    Node* nodes[LIST_CHUNK_SIZE];
+    PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head);
+    while (size_type n = fill_chunk(walker, values, nodes)) {
+        if (!fn(static_cast<const T*>(values), static_cast<Node* const*>(nodes), n)) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Calls a function on contiguous runs of the list's elements.
+ * 
+ * For trivially copyable `T` the elements are gathered into spans of up to `LIST_CHUNK_SIZE`
+ * elements so the callback can process them with vector instructions; changes made through the
+ * span are written back to the list afterwards. Other element types are passed one node at a time.
+ * A maintained rolling hash is recomputed on its next use.
+ * 
+ * @param fn Callable as `fn(std::span<T>)`.
+ */
+template <typename T>
+template<typename F>
+void List<T>::for_each_chunk(F&& fn) {
+    hash_dirty = hashing;
+    if constexpr (gathers_chunks) {
+        gather_chunks([&](const T* values, Node* const* nodes, size_type n) {
+            T* chunk = const_cast<T*>(values);
+            fn(std::span<T>(chunk, n));
+            for (size_type i = 0; i < n; ++i) {
+                std::memcpy(static_cast<void*>(std::addressof(nodes[i]->data)), chunk + i, sizeof(T));
+            }
+            return true;
+        });
+    }
+    else {
+        for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); Node* current = walker.live(); walker.advance()) {
+            fn(std::span<T>(std::addressof(current->data), 1));
+        }
+    }
+}
+
+/**
+ * @brief Calls a function on contiguous read-only runs of the list's elements.
+ * 
+ * For trivially copyable `T` the elements are gathered into spans of up to `LIST_CHUNK_SIZE`
+ * elements; other element types are passed one node at a time.
+ * 
+ * @param fn Callable as `fn(std::span<const T>)`.
+ */
+template <typename T>
+template<typename F>
+void List<T>::for_each_chunk(F&& fn) const {
+    if constexpr (gathers_chunks) {
+        gather_chunks([&](const T* values, Node* const*, size_type n) {
+            fn(std::span<const T>(values, n));
+            return true;
+        });
+    }
+    else {
+        for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); const Node* current = walker.live(); walker.advance()) {
+            fn(std::span<const T>(std::addressof(current->data), 1));
+        }
+    }
+}
+
+/**
+ * @brief Finds the first element equal to a value.
+ * 
+ * Trivially copyable element types are compared chunk by chunk with the SIMD kernels.
+ * 
+ * @param value The value to look for.
+ * @return An iterator to the first matching element, or `end()` if there is none.
+ */
+template <typename T>
+typename List<T>::iterator List<T>::find(const T& value) {
+    const List<T>& self = *this;
+    return iterator(const_cast<Node*>(self.find(value).node_ptr));
+}
+
+/**
+ * @brief Finds the first element equal to a value in a const list.
+ * 
+ * @param value The value to look for.
+ * @return A constant iterator to the first matching element, or `cend()` if there is none.
+ */
+template <typename T>
+typename List<T>::const_iterator List<T>::find(const T& value) const {
+    Node* found = nullptr;
+    if constexpr (gathers_chunks) {
+        gather_chunks([&](const T* values, Node* const* nodes, size_type n) {
+            size_type index = ListKernels<T>::find(values, n, value);
+            if (index < n) {
+                found = nodes[index];
+                return false;
+            }
+            return true;
+        });
+    }
+    else {
+        for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); Node* current = walker.live(); walker.advance()) {
+            if (current->data == value) {
+                found = current;
+                break;
+            }
+        }
+    }
+    return const_iterator(found);
+}
+
+/**
+ * @brief Looks up one key in each of many lists at once, interleaving the list walks.
+ * 
+ * Intended for many short independent chains, such as hash-bucket lists, where a plain loop of
+ * `find` calls stalls on every node. See `find_batch_if` for how the walks are interleaved.
+ * 
+ * @tparam Width The number of lists walked concurrently.
+ * @param lists The lists to search; `keys[i]` is looked up in `*lists[i]`.
+ * @param keys The key to look up in each list.
+ * @param results Receives a pointer to the first element equal to `keys[i]`, or nullptr.
+ * @throw std::invalid_argument if the three spans differ in length.
+ */
+template <typename T>
+template<std::size_t Width>
+void List<T>::find_batch(std::span<const List* const> lists, std::span<const T> keys, std::span<const T*> results) {
+    if (keys.size() != lists.size()) {
+        throw std::invalid_argument("find_batch: lists, keys and results must have the same length");
+    }
+    find_batch_if<Width>(lists, results, [keys](std::size_t i, const T& value) { return value == keys[i]; });
+}
+
+/**
+ * @brief Finds, in each of many lists, the first element satisfying a per-list predicate, interleaving the list walks.
+ * 
+ * Up to `Width` walks are kept in flight by `InterleavedTraversal`: each step of one walk
+ * prefetches its next node and then yields to the other walks, so the cache misses of different
+ * lists overlap instead of being paid one after another. Tombstoned elements are skipped.
+ * 
+ * @tparam Width The number of lists walked concurrently.
+ * @param lists The lists to search.
+ * @param results Receives a pointer to the first matching element of `*lists[i]`, or nullptr.
+ * @param pred Called as `pred(i, element)` to test an element of `*lists[i]`.
+ * @throw std::invalid_argument if `lists` and `results` differ in length.
+ */
+template <typename T>
+template<std::size_t Width, typename Pred>
+void List<T>::find_batch_if(std::span<const List* const> lists, std::span<const T*> results, Pred pred) {
+    if (results.size() != lists.size()) {
+        throw std::invalid_argument("find_batch: lists, keys and results must have the same length");
+    }
+    InterleavedTraversal<Width>::run(
+        lists.size(),
+        [&](std::size_t i) { return static_cast<const void*>(lists[i]); },
+        [&](std::size_t i) { return lists[i]->head; },
+        [](Node* node) { return node->next; },
+        [&](std::size_t i, const Node& node) { return !node.erased() && pred(i, node.data); },
+        [&](std::size_t i, Node* node) { results[i] = node ? &node->data : nullptr; });
+}
+
+/**
+ * @brief Counts the elements equal to a value.
+ * 
+ * @param value The value to count.
+ * @return The number of matching elements.
+ */
+template <typename T>
+typename List<T>::size_type List<T>::count(const T& value) const {
+    size_type matches = 0;
+    if constexpr (gathers_chunks) {
+        gather_chunks([&](const T* values, Node* const*, size_type n) {
+            matches += ListKernels<T>::count(values, n, value);
+            return true;
+        });
+    }
+    else {
+        for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); Node* current = walker.live(); walker.advance()) {
+            if (current->data == value) {
+                ++matches;
+            }
+        }
+    }
+    return matches;
+}
+
+/**
+ * @brief Returns the smallest element of the list.
+ * 
+ * @return A copy of the smallest element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+T List<T>::min() const {
+    T best = front();
+    if constexpr (gathers_chunks) {
+        gather_chunks([&](const T* values, Node* const*, size_type n) {
+            T candidate = ListKernels<T>::min(values, n);
+            if (candidate < best) {
+                best = candidate;
+            }
+            return true;
+        });
+    }
+    else {
+        for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); Node* current = walker.live(); walker.advance()) {
+            if (current->data < best) {
+                best = current->data;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Returns the largest element of the list.
+ * 
+ * @return A copy of the largest element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+T List<T>::max() const {
+    T best = front();
+    if constexpr (gathers_chunks) {
+        gather_chunks([&](const T* values, Node* const*, size_type n) {
+            T candidate = ListKernels<T>::max(values, n);
+            if (best < candidate) {
+                best = candidate;
+            }
+            return true;
+        });
+    }
+    else {
+        for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); Node* current = walker.live(); walker.advance()) {
+            if (best < current->data) {
+                best = current->data;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Sums the elements of the list.
+ * 
+ * @return The sum of all elements, or a value-initialized `T` if the list is empty.
+ */
+template <typename T>
+T List<T>::sum() const {
+    T total{};
+    if constexpr (gathers_chunks) {
+        gather_chunks([&](const T* values, Node* const*, size_type n) {
+            total += ListKernels<T>::sum(values, n);
+            return true;
+        });
+    }
+    else {
+        for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); Node* current = walker.live(); walker.advance()) {
+            total += current->data;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Removes every element equal to a value.
+ * 
+ * Each gathered chunk is compared in one vectorizable pass before the matching nodes are unlinked.
+ * 
+ * @param value The value to remove.
+ * @return The number of elements removed.
+ */
+template <typename T>
+typename List<T>::size_type List<T>::remove(const T& value) {
+    if constexpr (gathers_chunks) {
+        size_type removed = 0;
+        bool mask[LIST_CHUNK_SIZE];
+        gather_chunks([&](const T* values, Node* const* nodes, size_type n) {
+            ListKernels<T>::equal_mask(values, n, value, mask);
+            for (size_type i = 0; i < n; ++i) {
+                if (mask[i]) {
+                    erase(iterator(nodes[i]));
+                    ++removed;
+                }
+            }
+            return true;
+        });
+        return removed;
+    }
+    else {
+        return remove_if([&](const T& elem) { return elem == value; });
+    }
+}
+
+/**
+ * @brief Removes every element for which a predicate returns true.
+ * 
+ * For trivially copyable `T` the predicate is evaluated over a whole gathered chunk before any
+ * node is unlinked, which keeps the evaluation loop free of pointer chasing.
+ * 
+ * @param pred Callable as `pred(const T&)`.
+ * @return The number of elements removed.
+ */
+template <typename T>
+template<typename Pred>
+typename List<T>::size_type List<T>::remove_if(Pred pred) {
+    size_type removed = 0;
+    if constexpr (gathers_chunks) {
+        bool mask[LIST_CHUNK_SIZE];
+        gather_chunks([&](const T* values, Node* const* nodes, size_type n) {
+            for (size_type i = 0; i < n; ++i) {
+                mask[i] = static_cast<bool>(pred(values[i]));
+            }
+            for (size_type i = 0; i < n; ++i) {
+                if (mask[i]) {
+                    erase(iterator(nodes[i]));
+                    ++removed;
+                }
+            }
+            return true;
+        });
+    }
+    else {
+        PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head);
+        while (Node* current = walker.live()) {
+            walker.advance();
+            if (pred(current->data)) {
+                erase(iterator(current));
+                ++removed;
+            }
+        }
+    }
+    return removed;
+}
+
+/**
+ * @brief Marks an element as erased without unlinking it.
+ * 
+ * This is an O(1) flag write with no relinking or deallocation: the element immediately disappears
+ * from iteration, `getSize()` and the algorithms, and its node is freed by the next `sweep()`.
+ * If a sweep threshold is set and reached, the sweep runs before returning; like `erase`, this
+ * invalidates iterators to previously marked elements, but never the returned iterator.
+ * 
+ * @param pos The element to mark. Marking `end()` or an already marked element does nothing.
+ * @return An iterator to the next live element.
+ */
+template <typename T>
+typename List<T>::iterator List<T>::mark_erased(iterator pos) {
+    Node* current = pos.node_ptr;
+    if (!current) {
+        return end();
+    }
+    Node* next_node = live_forward(current->next);
+    if (!current->erased()) {
+        hash_unlinking(current);
+        current->set_erased();
+        --size;
+        ++tombstones;
+        if (sweep_threshold && tombstones >= sweep_threshold) {
+            sweep();
+        }
+    }
+    return iterator(next_node);
+}
+
+/**
+ * @brief Unlinks and frees every element marked by `mark_erased` in a single pass.
+ * 
+ * Live nodes are relinked to their nearest live neighbour as the walk goes, and a `prev` pointer
+ * is only written when it actually changes.
+ * 
+ * @return The number of nodes freed.
+ */
+template <typename T>
+typename List<T>::size_type List<T>::sweep() {
+    if (!tombstones) {
+        return 0;
+    }
+    size_type freed = tombstones;
+    Node* last_live = nullptr;
+    PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head);
+    while (Node* current = walker.current()) {
+        walker.advance();
+        if (current->erased()) {
+            delete current;
+            continue;
+        }
+        if (current->prev() != last_live) {
+            current->set_prev(last_live);
+        }
+        if (last_live) {
+            last_live->next = current;
+        }
+        else {
+            head = current;
+        }
+        last_live = current;
+    }
+    if (last_live) {
+        last_live->next = nullptr;
+    }
+    else {
+        head = nullptr;
+    }
+    tail = last_live;
+    tombstones = 0;
+    return freed;
+}
+
+/**
+ * @brief Sets how many marked elements trigger an automatic sweep.
+ * 
+ * @param threshold The number of tombstones at which `mark_erased` sweeps, or 0 to sweep only explicitly.
+ */
+template <typename T>
+void List<T>::set_sweep_threshold(size_type threshold) {
+    sweep_threshold = threshold;
+    if (sweep_threshold && tombstones >= sweep_threshold) {
+        sweep();
+    }
+}
+
+/**
+ * @brief Makes `clear()` and the destructor hand large chains to a background reclaimer.
+ * 
+ * Once enabled, tearing down a list of at least `threshold` nodes only detaches the chain; the
+ * elements are destroyed and their nodes freed by the `ListReclaimer` worker threads, which split
+ * long chains into `LIST_RECLAIMER_GRAIN` segments and destroy them in parallel. Element
+ * destructors therefore run on another thread, after `clear()` returns, and must not depend on
+ * state the caller tears down next. Call `ListReclaimer::instance().drain()` to wait for them.
+ * 
+ * @param threshold The node count from which teardown is deferred, or 0 to always tear down inline.
+ */
+template <typename T>
+void List<T>::set_deferred_teardown(size_type threshold) {
+    teardown_threshold = threshold;
+}
+
+/**
+ * @brief Returns the number of marked elements waiting for a sweep.
+ * 
+ * @return The number of tombstones still linked into the list.
+ */
+template <typename T>
+typename List<T>::size_type List<T>::erased_count() const {
+    return tombstones;
+}
+
+/**
+ * @brief Copies the list's elements, in order, into a contiguous buffer.
+ * 
+ * The source nodes are prefetched ahead of the copy. If the buffer is shorter than the list,
+ * only the leading elements that fit are copied.
+ * 
+ * @param out The destination buffer.
+ * @return The number of elements copied.
+ */
+template <typename T>
+typename List<T>::size_type List<T>::copy_to(std::span<T> out) const {
+    size_type copied = 0;
+    for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); walker.current() && copied < out.size(); walker.advance()) {
+        if (!walker.current()->erased()) {
+            out[copied++] = walker.current()->data;
+        }
+    }
+    return copied;
+}
+
+/**
+ * @brief Copies the list into a new vector.
+ * 
+ * The vector is allocated exactly once from the cached size, so there is no growth and
+ * no reallocation while the prefetching walk appends the elements.
+ * 
+ * @return A vector holding copies of the list's elements, in order.
+ */
+template <typename T>
+std::vector<T> List<T>::to_vector() const {
+    std::vector<T> out;
+    out.reserve(size);
+    for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); walker.current(); walker.advance()) {
+        if (!walker.current()->erased()) {
+            out.push_back(walker.current()->data);
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Moves every element to the end of a vector and empties the list.
+ * 
+ * The vector grows at most once, to its current size plus the list's size, before the elements
+ * are moved across; each node is freed right after its element has been moved out.
+ * 
+ * @param out The vector to append the elements to.
+ */
+template <typename T>
+void List<T>::move_into(std::vector<T>& out) {
+    out.reserve(out.size() + size);
+    PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head);
+    while (Node* current = walker.current()) {
+        walker.advance();
+        if (!current->erased()) {
+            out.push_back(std::move(current->data));
+        }
+        delete current;
+    }
+    head = tail = nullptr;
+    size = 0;
+    tombstones = 0;
+    reset_hash();
+}
+
+/**
+ * @brief Equality comparison operator for lists.
+ * 
+ * Lists of different sizes are rejected from the cached size without touching any node, as are
+ * lists whose maintained rolling hashes are both up to date and differ. Otherwise
+ * both lists are walked in lockstep with prefetching; element types whose value is fully determined
+ * by their bytes are gathered into chunks and compared with `memcmp`.
+ * 
+ * @param other The list to compare against.
+ * @return true if both lists hold equal elements in the same order, false otherwise.
+ */
+template <typename T>
+bool List<T>::operator==(const List<T>& other) const {
+    if (size != other.size) {
+        return false;
+    }
+    if (this == &other) {
+        return true;
+    }
+    if (hashing && other.hashing && !hash_dirty && !other.hash_dirty && rolling != other.rolling) {
+        return false;
+    }
+    PrefetchWalker<LIST_PREFETCH_DISTANCE> mine(head);
+    PrefetchWalker<LIST_PREFETCH_DISTANCE> theirs(other.head);
+    if constexpr (gathers_chunks && std::has_unique_object_representations_v<T>) {
+        alignas(T) unsigned char mine_storage[sizeof(T) * LIST_CHUNK_SIZE];
+        alignas(T) unsigned char theirs_storage[sizeof(T) * LIST_CHUNK_SIZE];
+        T* mine_values = std::launder(reinterpret_cast<T*>(mine_storage));
+        T* theirs_values = std::launder(reinterpret_cast<T*>(theirs_storage));
+        while (true) {
+            size_type n = fill_chunk(mine, mine_values, nullptr);
+            size_type m = fill_chunk(theirs, theirs_values, nullptr);
+            if (n != m) {
+                return false;
+            }
+            if (!n) {
+                return true;
+            }
+            if (std::memcmp(mine_values, theirs_values, n * sizeof(T)) != 0) {
+                return false;
+            }
+        }
+    }
+    else {
+        while (true) {
+            Node* x = mine.live();
+            Node* y = theirs.live();
+            if (!x || !y) {
+                return x == y;
+            }
+            if (!(x->data == y->data)) {
+                return false;
+            }
+            mine.advance();
+            theirs.advance();
+        }
+    }
+}
+
+/**
+ * @brief Lexicographic three-way comparison operator for lists.
+ * 
+ * Both lists are walked in lockstep with prefetching until the first unequal pair of elements;
+ * if one list is a prefix of the other, the shorter list orders first.
+ * 
+ * @param other The list to compare against.
+ * @return The ordering of this list relative to `other`.
+ */
+template <typename T>
+auto List<T>::operator<=>(const List<T>& other) const requires std::three_way_comparable<T> {
+    using ordering = std::compare_three_way_result_t<T>;
+    PrefetchWalker<LIST_PREFETCH_DISTANCE> mine(head);
+    PrefetchWalker<LIST_PREFETCH_DISTANCE> theirs(other.head);
+    while (true) {
+        Node* x = mine.live();
+        Node* y = theirs.live();
+        if (!x || !y) {
+            return ordering((x != nullptr) <=> (y != nullptr));
+        }
+        if (ordering order = x->data <=> y->data; order != 0) {
+            return order;
+        }
+        mine.advance();
+        theirs.advance();
+    }
+}
+
+/**
+ * @brief Computes an order-sensitive hash of the list's contents.
+ * 
+ * Element hashes from `std::hash<T>` are folded in list order, seeded with the size, so equal
+ * lists hash equally and reordering the elements changes the result.
+ * 
+ * @return The hash of the list.
+ */
+template <typename T>
+std::size_t List<T>::hash_code() const {
+    std::size_t seed = std::hash<size_type>{}(size);
+    for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); walker.live(); walker.advance()) {
+        seed ^= std::hash<T>{}(walker.current()->data) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+/**
+ * @brief Hashes a list so it can be used as a key in unordered containers.
+ * 
+ * @param list The list to hash.
+ * @return The value of `list.hash_code()`.
+ */
+template <typename T>
+std::size_t std::hash<List<T>>::operator()(const List<T>& list) const {
+    return list.hash_code();
+}
+
+/**
+ * @brief Multiplies two residues modulo the Mersenne prime 2^61 - 1 used by the rolling hash.
+ * 
+ * @param a The first factor, less than the modulus.
+ * @param b The second factor, less than the modulus.
+ * @return `a * b mod (2^61 - 1)`.
+ */
+template <typename T>
+constexpr std::uint64_t List<T>::hash_mul(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 wide;
+    wide product = static_cast<wide>(a) * b;
+    std::uint64_t reduced = (static_cast<std::uint64_t>(product) & hash_modulus) + static_cast<std::uint64_t>(product >> 61);
+#else
+    const std::uint64_t low31 = (std::uint64_t(1) << 31) - 1;
+    const std::uint64_t low30 = (std::uint64_t(1) << 30) - 1;
+    std::uint64_t a_hi = a >> 31, a_lo = a & low31;
+    std::uint64_t b_hi = b >> 31, b_lo = b & low31;
+    std::uint64_t mid = a_hi * b_lo + a_lo * b_hi;
+    std::uint64_t reduced = ((a_hi * b_hi) << 1) + (mid >> 30) + ((mid & low30) << 31) + a_lo * b_lo;
+    reduced = (reduced & hash_modulus) + (reduced >> 61);
+#endif
+    reduced = (reduced & hash_modulus) + (reduced >> 61);
+    return reduced >= hash_modulus ? reduced - hash_modulus : reduced;
+}
+
+/**
+ * @brief Adds two residues modulo 2^61 - 1.
+ * 
+ * @param a The first term, less than the modulus.
+ * @param b The second term, less than the modulus.
+ * @return `a + b mod (2^61 - 1)`.
+ */
+template <typename T>
+constexpr std::uint64_t List<T>::hash_add(std::uint64_t a, std::uint64_t b) {
+    std::uint64_t total = a + b;
+    return total >= hash_modulus ? total - hash_modulus : total;
+}
+
+/**
+ * @brief Subtracts two residues modulo 2^61 - 1.
+ * 
+ * @param a The minuend, less than the modulus.
+ * @param b The subtrahend, less than the modulus.
+ * @return `a - b mod (2^61 - 1)`.
+ */
+template <typename T>
+constexpr std::uint64_t List<T>::hash_sub(std::uint64_t a, std::uint64_t b) {
+    return a >= b ? a - b : a + hash_modulus - b;
+}
+
+/**
+ * @brief Raises a residue to a power modulo 2^61 - 1.
+ * 
+ * @param base The residue to raise.
+ * @param exponent The power.
+ * @return `base^exponent mod (2^61 - 1)`.
+ */
+template <typename T>
+constexpr std::uint64_t List<T>::hash_pow(std::uint64_t base, std::uint64_t exponent) {
+    std::uint64_t result = 1;
+    while (exponent) {
+        if (exponent & 1) {
+            result = hash_mul(result, base);
+        }
+        base = hash_mul(base, base);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+/**
+ * @brief The multiplicative inverse of the rolling-hash base, used to remove the last element in O(1).
+ */
+template <typename T>
+const std::uint64_t List<T>::hash_base_inverse = List<T>::hash_pow(List<T>::hash_base, List<T>::hash_modulus - 2);
+
+/**
+ * @brief Maps an element to a residue of the rolling hash.
+ * 
+ * Element types without a `std::hash` specialization never enable the rolling hash, so for them
+ * this is never reached at run time and only has to compile.
+ * 
+ * @param value The element to hash.
+ * @return `std::hash<T>` of the element, reduced modulo 2^61 - 1.
+ */
+template <typename T>
+std::uint64_t List<T>::element_hash(const T& value) {
+    if constexpr (hashable) {
+        std::uint64_t h = static_cast<std::uint64_t>(std::hash<T>{}(value));
+        h = (h & hash_modulus) + (h >> 61);
+        return h >= hash_modulus ? h - hash_modulus : h;
+    }
+    else {
+        (void)value;
+        return 0;
+    }
+}
+
+/**
+ * @brief Updates the rolling hash after a live node has been linked and counted.
+ * 
+ * The hash is `sum(h(x_i) * B^(n-1-i))`, so a node linked at the back or the front is folded
+ * in with one multiply-add. A node linked in the middle marks the hash for recomputation.
+ * 
+ * @param node The node that was just linked.
+ */
+template <typename T>
+void List<T>::hash_linked(Node* node) {
+    if (!hashing || hash_dirty) {
+        return;
+    }
+    if (node == tail) {
+        rolling = hash_add(hash_mul(rolling, hash_base), element_hash(node->data));
+        rolling_pow = hash_mul(rolling_pow, hash_base);
+    }
+    else if (node == head) {
+        rolling = hash_add(rolling, hash_mul(element_hash(node->data), rolling_pow));
+        rolling_pow = hash_mul(rolling_pow, hash_base);
+    }
+    else {
+        hash_dirty = true;
+    }
+}
+
+/**
+ * @brief Updates the rolling hash before a live node is unlinked or marked as erased.
+ * 
+ * Removing the back element subtracts its term and divides by the base; removing the front
+ * element subtracts its term scaled by `B^(n-1)`. Any other position marks the hash for
+ * recomputation.
+ * 
+ * @param node The node about to be removed.
+ */
+template <typename T>
+void List<T>::hash_unlinking(Node* node) {
+    if (!hashing || hash_dirty) {
+        return;
+    }
+    if (node == tail) {
+        rolling = hash_mul(hash_sub(rolling, element_hash(node->data)), hash_base_inverse);
+        rolling_pow = hash_mul(rolling_pow, hash_base_inverse);
+    }
+    else if (node == head) {
+        rolling_pow = hash_mul(rolling_pow, hash_base_inverse);
+        rolling = hash_sub(rolling, hash_mul(element_hash(node->data), rolling_pow));
+    }
+    else {
+        hash_dirty = true;
+    }
+}
+
+/**
+ * @brief Resets the rolling hash to the value of an empty list, keeping the mode unchanged.
+ */
+template <typename T>
+void List<T>::reset_hash() {
+    rolling = 0;
+    rolling_pow = 1;
+    hash_dirty = false;
+}
+
+/**
+ * @brief Computes the polynomial hash of the list's contents in one prefetching pass.
+ * 
+ * Reads the list only, so concurrent calls on a shared list are safe.
+ * 
+ * @param power Receives `hash_base` raised to the number of live elements.
+ * @return The hash of the contents.
+ */
+template <typename T>
+std::uint64_t List<T>::compute_hash(std::uint64_t& power) const {
+    std::uint64_t value = 0;
+    power = 1;
+    for (PrefetchWalker<LIST_PREFETCH_DISTANCE> walker(head); walker.live(); walker.advance()) {
+        value = hash_add(hash_mul(value, hash_base), element_hash(walker.current()->data));
+        power = hash_mul(power, hash_base);
+    }
+    return value;
+}
+
+/**
+ * @brief Recomputes the maintained rolling hash from the list's contents and clears the dirty flag.
+ */
+template <typename T>
+void List<T>::recompute_hash() const {
+    rolling = compute_hash(rolling_pow);
+    hash_dirty = false;
+}
+
+/**
+ * @brief Moves all elements of another list into this one before the given position.
+ * 
+ * No elements are copied or reallocated; the other list's chain is relinked in O(1) and the
+ * other list is left empty. If both lists maintain a rolling hash and the position is the front
+ * or the back, the two hashes are combined in O(1) as `H_front * B^(n_back) + H_back`.
+ * 
+ * @param pos The position before which the elements are inserted.
+ * @param other The list whose elements are moved.
+ */
+template <typename T>
+void List<T>::splice(typename List<T>::const_iterator pos, List<T>& other) {
+    if (this == &other || !other.head) {
+        return;
+    }
+    Node* current = pos.node_ptr;
+    if (hashing && !hash_dirty) {
+        if (current && current != live_forward(head)) {
+            hash_dirty = true;
+        }
+        else {
+            if (!other.hashing || other.hash_dirty) {
+                other.recompute_hash();
+            }
+            if (!current) {
+                rolling = hash_add(hash_mul(rolling, other.rolling_pow), other.rolling);
+            }
+            else {
+                rolling = hash_add(hash_mul(other.rolling, rolling_pow), rolling);
+            }
+            rolling_pow = hash_mul(rolling_pow, other.rolling_pow);
+        }
+    }
+
+    if (!current) {
+        if (tail) {
+            tail->next = other.head;
+            other.head->set_prev(tail);
+        }
+        else {
+            head = other.head;
+        }
+        tail = other.tail;
+    }
+    else {
+        Node* before = current->prev();
+        other.head->set_prev(before);
+        other.tail->next = current;
+        current->set_prev(other.tail);
+        if (before) {
+            before->next = other.head;
+        }
+        else {
+            head = other.head;
+        }
+    }
+    size += other.size;
+    tombstones += other.tombstones;
+
+    other.head = other.tail = nullptr;
+    other.size = 0;
+    other.tombstones = 0;
+    other.reset_hash();
+}
+
+/**
+ * @brief Turns on the incrementally maintained rolling content hash.
+ * 
+ * The hash is computed once now and from then on updated in O(1) by every push, pop, front or
+ * back insert and erase, and front or back splice. Middle insertions and erasures defer to a
+ * single recomputation on the next query.
+ */
+template <typename T>
+void List<T>::enable_rolling_hash() {
+    static_assert(hashable, "the rolling content hash requires std::hash<T>");
+    hashing = true;
+    recompute_hash();
+}
+
+/**
+ * @brief Turns off the rolling content hash, removing its per-mutation cost.
+ */
+template <typename T>
+void List<T>::disable_rolling_hash() {
+    hashing = false;
+    reset_hash();
+}
+
+/**
+ * @brief Checks whether the rolling content hash is being maintained.
+ * 
+ * @return true if `enable_rolling_hash()` is in effect.
+ */
+template <typename T>
+bool List<T>::rolling_hash_enabled() const {
+    return hashing;
+}
+
+/**
+ * @brief Returns the order-sensitive polynomial hash of the list's contents.
+ * 
+ * With the rolling hash enabled this is O(1) unless a middle mutation is pending; otherwise the
+ * hash is computed from scratch. Equal lists always have equal hashes.
+ * 
+ * With the rolling hash disabled, or enabled and up to date, this only reads the list. A pending
+ * recompute is cached in the maintained hash, which is a write: like any mutation, it must not
+ * race with other calls on the same list. Call `refresh_content_hash()` before sharing the list
+ * between threads to make later calls read-only.
+ * 
+ * @return The polynomial hash modulo 2^61 - 1.
+ */
+template <typename T>
+std::uint64_t List<T>::content_hash() const {
+    if (!hashing) {
+        std::uint64_t power;
+        return compute_hash(power);
+    }
+    if (hash_dirty) {
+        recompute_hash();
+    }
+    return rolling;
+}
+
+/**
+ * @brief Recomputes the rolling hash after elements were modified in place.
+ * 
+ * Writes through iterators or references bypass the list, so callers that mutate elements
+ * that way must call this before relying on `content_hash()` again.
+ */
+template <typename T>
+void List<T>::refresh_content_hash() {
+    if (hashing) {
+        recompute_hash();
+    }
+}
+
+/**
+ * @brief Releases empty slabs of the node pool used by this list type back to the operating system.
+ * 
+ * Nodes of every `List` whose node has the same size and alignment share one pool, so this
+ * trims on behalf of all of them. Use `NodePoolRegistry::trim` to trim every pool at once.
+ * 
+ * @param target_bytes The reserved size the pool should shrink towards.
+ * @return The number of bytes released.
+ */
+template <typename T>
+typename List<T>::size_type List<T>::trim(size_type target_bytes) {
+#ifndef LIST_DISABLE_NODE_POOL
+    return NodePool<sizeof(Node), alignof(Node)>::instance().trim(target_bytes);
+#else
+    (void)target_bytes;
+    return 0;
+#endif
+}
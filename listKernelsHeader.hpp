@@ -0,0 +1,25 @@
+#ifndef LIST_KERNELS_H
+#define LIST_KERNELS_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX__) || defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+template <typename T>
+struct ListKernels {
+    static std::size_t find(const T*, std::size_t, const T&);
+    static std::size_t count(const T*, std::size_t, const T&);
+    static T min(const T*, std::size_t);
+    static T max(const T*, std::size_t);
+    static T sum(const T*, std::size_t);
+    static void equal_mask(const T*, std::size_t, const T&, bool*);
+};
+
+#include "listKernelsImplementation.tpp"
+
+#endif
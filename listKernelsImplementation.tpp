@@ -0,0 +1,335 @@
+#include "listKernelsHeader.hpp"
+
+/**
+ * @brief Finds the first element equal to a value in a contiguous run.
+ *
+ * `float` and `int32_t` runs are compared eight (AVX/AVX2) or four (SSE2) lanes at a time;
+ * every other type, and the tail of the run, uses a scalar loop.
+ *
+ * @param data The first element of the run.
+ * @param n The number of elements in the run.
+ * @param value The value to look for.
+ * @return The index of the first match, or `n` if there is none.
+ */
+template <typename T>
+std::size_t ListKernels<T>::find(const T* data, std::size_t n, const T& value) {
+    std::size_t i = 0;
+    if constexpr (std::is_same_v<T, float>) {
+#if defined(__AVX__)
+        const __m256 needle = _mm256_set1_ps(value);
+        for (; i + 8 <= n; i += 8) {
+            int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ));
+            if (mask) {
+                return i + std::countr_zero(static_cast<unsigned>(mask));
+            }
+        }
+#elif defined(__SSE2__)
+        const __m128 needle = _mm_set1_ps(value);
+        for (; i + 4 <= n; i += 4) {
+            int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle));
+            if (mask) {
+                return i + std::countr_zero(static_cast<unsigned>(mask));
+            }
+        }
+#endif
+    }
+    else if constexpr (std::is_same_v<T, std::int32_t>) {
+#if defined(__AVX2__)
+        const __m256i needle = _mm256_set1_epi32(value);
+        for (; i + 8 <= n; i += 8) {
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lanes, needle)));
+            if (mask) {
+                return i + std::countr_zero(static_cast<unsigned>(mask));
+            }
+        }
+#elif defined(__SSE2__)
+        const __m128i needle = _mm_set1_epi32(value);
+        for (; i + 4 <= n; i += 4) {
+            __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lanes, needle)));
+            if (mask) {
+                return i + std::countr_zero(static_cast<unsigned>(mask));
+            }
+        }
+#endif
+    }
+    for (; i < n; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Counts the elements equal to a value in a contiguous run.
+ *
+ * Vectorized for `float` and `int32_t` by popcounting the lane comparison masks.
+ *
+ * @param data The first element of the run.
+ * @param n The number of elements in the run.
+ * @param value The value to count.
+ * @return The number of matching elements.
+ */
+template <typename T>
+std::size_t ListKernels<T>::count(const T* data, std::size_t n, const T& value) {
+    std::size_t i = 0;
+    std::size_t matches = 0;
+    if constexpr (std::is_same_v<T, float>) {
+#if defined(__AVX__)
+        const __m256 needle = _mm256_set1_ps(value);
+        for (; i + 8 <= n; i += 8) {
+            int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ));
+            matches += std::popcount(static_cast<unsigned>(mask));
+        }
+#elif defined(__SSE2__)
+        const __m128 needle = _mm_set1_ps(value);
+        for (; i + 4 <= n; i += 4) {
+            int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle));
+            matches += std::popcount(static_cast<unsigned>(mask));
+        }
+#endif
+    }
+    else if constexpr (std::is_same_v<T, std::int32_t>) {
+#if defined(__AVX2__)
+        const __m256i needle = _mm256_set1_epi32(value);
+        for (; i + 8 <= n; i += 8) {
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lanes, needle)));
+            matches += std::popcount(static_cast<unsigned>(mask));
+        }
+#elif defined(__SSE2__)
+        const __m128i needle = _mm_set1_epi32(value);
+        for (; i + 4 <= n; i += 4) {
+            __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lanes, needle)));
+            matches += std::popcount(static_cast<unsigned>(mask));
+        }
+#endif
+    }
+    for (; i < n; ++i) {
+        if (data[i] == value) {
+            ++matches;
+        }
+    }
+    return matches;
+}
+
+/**
+ * @brief Returns the smallest element of a non-empty contiguous run.
+ *
+ * Vectorized for `float` (AVX/SSE2) and `int32_t` (AVX2/SSE4.1). Vector `float` minimum does not
+ * propagate NaN the way a scalar `<` loop would.
+ *
+ * @param data The first element of the run.
+ * @param n The number of elements in the run; must be at least one.
+ * @return The smallest element.
+ */
+template <typename T>
+T ListKernels<T>::min(const T* data, std::size_t n) {
+    std::size_t i = 1;
+    T best = data[0];
+    if constexpr (std::is_same_v<T, float>) {
+#if defined(__AVX__)
+        if (n >= 8) {
+            __m256 acc = _mm256_loadu_ps(data);
+            for (i = 8; i + 8 <= n; i += 8) {
+                acc = _mm256_min_ps(acc, _mm256_loadu_ps(data + i));
+            }
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, acc);
+            best = lanes[0];
+            for (float lane : lanes) best = lane < best ? lane : best;
+        }
+#elif defined(__SSE2__)
+        if (n >= 4) {
+            __m128 acc = _mm_loadu_ps(data);
+            for (i = 4; i + 4 <= n; i += 4) {
+                acc = _mm_min_ps(acc, _mm_loadu_ps(data + i));
+            }
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, acc);
+            best = lanes[0];
+            for (float lane : lanes) best = lane < best ? lane : best;
+        }
+#endif
+    }
+    else if constexpr (std::is_same_v<T, std::int32_t>) {
+#if defined(__AVX2__)
+        if (n >= 8) {
+            __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            for (i = 8; i + 8 <= n; i += 8) {
+                acc = _mm256_min_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            }
+            alignas(32) std::int32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            best = lanes[0];
+            for (std::int32_t lane : lanes) best = lane < best ? lane : best;
+        }
+#elif defined(__SSE4_1__)
+        if (n >= 4) {
+            __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            for (i = 4; i + 4 <= n; i += 4) {
+                acc = _mm_min_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+            }
+            alignas(16) std::int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            best = lanes[0];
+            for (std::int32_t lane : lanes) best = lane < best ? lane : best;
+        }
+#endif
+    }
+    for (; i < n; ++i) {
+        if (data[i] < best) {
+            best = data[i];
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Returns the largest element of a non-empty contiguous run.
+ *
+ * Vectorized for `float` (AVX/SSE2) and `int32_t` (AVX2/SSE4.1), with the same NaN caveat as `min`.
+ *
+ * @param data The first element of the run.
+ * @param n The number of elements in the run; must be at least one.
+ * @return The largest element.
+ */
+template <typename T>
+T ListKernels<T>::max(const T* data, std::size_t n) {
+    std::size_t i = 1;
+    T best = data[0];
+    if constexpr (std::is_same_v<T, float>) {
+#if defined(__AVX__)
+        if (n >= 8) {
+            __m256 acc = _mm256_loadu_ps(data);
+            for (i = 8; i + 8 <= n; i += 8) {
+                acc = _mm256_max_ps(acc, _mm256_loadu_ps(data + i));
+            }
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, acc);
+            best = lanes[0];
+            for (float lane : lanes) best = best < lane ? lane : best;
+        }
+#elif defined(__SSE2__)
+        if (n >= 4) {
+            __m128 acc = _mm_loadu_ps(data);
+            for (i = 4; i + 4 <= n; i += 4) {
+                acc = _mm_max_ps(acc, _mm_loadu_ps(data + i));
+            }
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, acc);
+            best = lanes[0];
+            for (float lane : lanes) best = best < lane ? lane : best;
+        }
+#endif
+    }
+    else if constexpr (std::is_same_v<T, std::int32_t>) {
+#if defined(__AVX2__)
+        if (n >= 8) {
+            __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            for (i = 8; i + 8 <= n; i += 8) {
+                acc = _mm256_max_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            }
+            alignas(32) std::int32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            best = lanes[0];
+            for (std::int32_t lane : lanes) best = best < lane ? lane : best;
+        }
+#elif defined(__SSE4_1__)
+        if (n >= 4) {
+            __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            for (i = 4; i + 4 <= n; i += 4) {
+                acc = _mm_max_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+            }
+            alignas(16) std::int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            best = lanes[0];
+            for (std::int32_t lane : lanes) best = best < lane ? lane : best;
+        }
+#endif
+    }
+    for (; i < n; ++i) {
+        if (best < data[i]) {
+            best = data[i];
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Sums a contiguous run.
+ *
+ * Vectorized for `float` and `int32_t`. The vector `float` path adds in lane order rather than
+ * left to right, so rounding can differ slightly from a scalar loop.
+ *
+ * @param data The first element of the run.
+ * @param n The number of elements in the run.
+ * @return The sum of the elements, or a value-initialized `T` for an empty run.
+ */
+template <typename T>
+T ListKernels<T>::sum(const T* data, std::size_t n) {
+    std::size_t i = 0;
+    T total{};
+    if constexpr (std::is_same_v<T, float>) {
+#if defined(__AVX__)
+        __m256 acc = _mm256_setzero_ps();
+        for (; i + 8 <= n; i += 8) {
+            acc = _mm256_add_ps(acc, _mm256_loadu_ps(data + i));
+        }
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, acc);
+        for (float lane : lanes) total += lane;
+#elif defined(__SSE2__)
+        __m128 acc = _mm_setzero_ps();
+        for (; i + 4 <= n; i += 4) {
+            acc = _mm_add_ps(acc, _mm_loadu_ps(data + i));
+        }
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, acc);
+        for (float lane : lanes) total += lane;
+#endif
+    }
+    else if constexpr (std::is_same_v<T, std::int32_t>) {
+#if defined(__AVX2__)
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 8 <= n; i += 8) {
+            acc = _mm256_add_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+        }
+        alignas(32) std::int32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        for (std::int32_t lane : lanes) total += lane;
+#elif defined(__SSE2__)
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= n; i += 4) {
+            acc = _mm_add_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+        }
+        alignas(16) std::int32_t lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        for (std::int32_t lane : lanes) total += lane;
+#endif
+    }
+    for (; i < n; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+/**
+ * @brief Flags every element of a contiguous run that equals a value.
+ *
+ * Written as a branch-free loop so the compiler can vectorize it for any trivially comparable `T`.
+ *
+ * @param data The first element of the run.
+ * @param n The number of elements in the run.
+ * @param value The value to compare against.
+ * @param mask Output array of `n` flags, set to true where `data[i] == value`.
+ */
+template <typename T>
+void ListKernels<T>::equal_mask(const T* data, std::size_t n, const T& value, bool* mask) {
+    for (std::size_t i = 0; i < n; ++i) {
+        mask[i] = (data[i] == value);
+    }
+}
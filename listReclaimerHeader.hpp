@@ -0,0 +1,56 @@
+#ifndef LIST_RECLAIMER_H
+#define LIST_RECLAIMER_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef LIST_RECLAIMER_THREADS
+#define LIST_RECLAIMER_THREADS 0
+#endif
+
+#ifndef LIST_RECLAIMER_GRAIN
+#define LIST_RECLAIMER_GRAIN 4096
+#endif
+
+class ListReclaimer {
+public:
+    struct Chain {
+        void* first;
+        std::size_t count;
+        void* (*skip)(void*, std::size_t);
+        void (*destroy)(void*, std::size_t);
+    };
+
+    static ListReclaimer& instance();
+
+    explicit ListReclaimer(unsigned = 0);
+    ListReclaimer(const ListReclaimer&) = delete;
+    ListReclaimer& operator=(const ListReclaimer&) = delete;
+    ~ListReclaimer();
+
+    void retire(Chain);
+    void drain();
+    void shutdown();
+    std::size_t pending() const;
+    unsigned threads() const;
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::vector<Chain> chains;
+    std::vector<std::thread> workers;
+    std::size_t pending_nodes;
+    std::size_t active;
+    bool stopping;
+
+    void run();
+};
+
+#include "listReclaimerImplementation.tpp"
+
+#endif
@@ -0,0 +1,160 @@
+#include "listReclaimerHeader.hpp"
+
+/**
+ * @brief Returns the process-wide reclaimer used by lists with deferred teardown.
+ *
+ * The worker threads are started on first use. At program exit the reclaimer finishes every
+ * chain handed to it and joins its threads; the object itself is never destroyed, so lists with
+ * static storage duration that are torn down later still find it and free their nodes inline.
+ *
+ * @return The reclaimer instance.
+ */
+inline ListReclaimer& ListReclaimer::instance() {
+    static ListReclaimer* reclaimer = new ListReclaimer(LIST_RECLAIMER_THREADS);
+    static struct ShutdownAtExit {
+        ~ShutdownAtExit() { reclaimer->shutdown(); }
+    } shutdown_at_exit;
+    return *reclaimer;
+}
+
+/**
+ * @brief Starts the worker threads that destroy retired chains.
+ *
+ * @param thread_count The number of workers, or 0 for half the hardware concurrency (at least one).
+ */
+inline ListReclaimer::ListReclaimer(unsigned thread_count) : pending_nodes(0), active(0), stopping(false) {
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency() / 2);
+    }
+    workers.reserve(thread_count);
+    for (unsigned i = 0; i < thread_count; ++i) {
+        workers.emplace_back([this] { run(); });
+    }
+}
+
+/**
+ * @brief Destroys every retired chain, then stops and joins the worker threads.
+ */
+inline ListReclaimer::~ListReclaimer() {
+    shutdown();
+}
+
+/**
+ * @brief Hands a detached node chain to the workers.
+ *
+ * Only the chain descriptor is queued, so the caller spends O(1) time regardless of the chain's
+ * length. A worker that picks up a chain longer than `LIST_RECLAIMER_GRAIN` nodes walks to the
+ * end of its first grain, requeues the remainder for the other workers, and destroys its grain.
+ * After `shutdown()`, or if the descriptor cannot be queued, the chain is destroyed on the
+ * calling thread instead.
+ *
+ * @param chain The first node, node count, and the functions that step over and destroy nodes.
+ */
+inline void ListReclaimer::retire(Chain chain) {
+    if (!chain.first || chain.count == 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!stopping) {
+            try {
+                chains.push_back(chain);
+                pending_nodes += chain.count;
+                chain.first = nullptr;
+            }
+            catch (...) {
+            }
+        }
+    }
+    if (chain.first) {
+        chain.destroy(chain.first, chain.count);
+        return;
+    }
+    wake.notify_one();
+}
+
+/**
+ * @brief Blocks until every chain retired so far has been destroyed.
+ */
+inline void ListReclaimer::drain() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return chains.empty() && active == 0; });
+}
+
+/**
+ * @brief Finishes the queued chains and joins the worker threads.
+ *
+ * Chains retired afterwards are destroyed on the retiring thread. Calling this more than once
+ * has no further effect.
+ */
+inline void ListReclaimer::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of retired nodes that have not been destroyed yet.
+ *
+ * @return The number of pending nodes.
+ */
+inline std::size_t ListReclaimer::pending() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pending_nodes;
+}
+
+/**
+ * @brief Returns the number of worker threads.
+ *
+ * @return The number of workers started by the constructor.
+ */
+inline unsigned ListReclaimer::threads() const {
+    return static_cast<unsigned>(workers.size());
+}
+
+/**
+ * @brief Destroys retired chains one grain at a time until shutdown leaves the queue empty.
+ */
+inline void ListReclaimer::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wake.wait(lock, [this] { return stopping || !chains.empty(); });
+        if (chains.empty()) {
+            return;
+        }
+        Chain chain = chains.back();
+        chains.pop_back();
+        ++active;
+        lock.unlock();
+
+        if (chain.count > LIST_RECLAIMER_GRAIN) {
+            Chain rest = chain;
+            rest.first = chain.skip(chain.first, LIST_RECLAIMER_GRAIN);
+            rest.count = chain.count - LIST_RECLAIMER_GRAIN;
+            lock.lock();
+            try {
+                chains.push_back(rest);
+                chain.count = LIST_RECLAIMER_GRAIN;
+            }
+            catch (...) {
+            }
+            lock.unlock();
+            wake.notify_one();
+        }
+        chain.destroy(chain.first, chain.count);
+
+        lock.lock();
+        --active;
+        pending_nodes -= chain.count;
+        if (chains.empty() && active == 0) {
+            idle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef MPMC_LIST_H
+#define MPMC_LIST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "epochReclaimerHeader.hpp"
+#include "nodePoolHeader.hpp"
+
+#ifndef MPMC_LIST_SEGMENT_SLOTS
+#define MPMC_LIST_SEGMENT_SLOTS 128
+#endif
+
+#ifndef MPMC_LIST_CACHE_LINE
+#define MPMC_LIST_CACHE_LINE 64
+#endif
+
+template <typename T>
+class MpmcList {
+    static_assert(std::is_nothrow_move_constructible_v<T>, "MpmcList requires a nothrow move constructible T");
+
+private:
+    static constexpr std::size_t segment_slots = MPMC_LIST_SEGMENT_SLOTS;
+
+    enum : std::uint32_t { slot_empty = 0, slot_full = 1, slot_taken = 2 };
+
+    struct Slot {
+        std::atomic<std::uint32_t> state;
+        alignas(T) unsigned char storage[sizeof(T)];
+        T* value();
+    };
+
+    struct Segment {
+        alignas(MPMC_LIST_CACHE_LINE) std::atomic<std::size_t> enqueue_index;
+        alignas(MPMC_LIST_CACHE_LINE) std::atomic<std::size_t> dequeue_index;
+        alignas(MPMC_LIST_CACHE_LINE) std::atomic<Segment*> next;
+        Slot slots[segment_slots];
+        Segment();
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+        static void reclaim(void*);
+    };
+
+    alignas(MPMC_LIST_CACHE_LINE) std::atomic<Segment*> head;
+    alignas(MPMC_LIST_CACHE_LINE) std::atomic<Segment*> tail;
+
+    void enqueue(T&&);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    MpmcList();
+    MpmcList(const MpmcList&) = delete;
+    MpmcList& operator=(const MpmcList&) = delete;
+    ~MpmcList();
+
+    void push(const T&);
+    void push(T&&);
+
+    template<typename... Args>
+    void emplace(Args&&...);
+
+    bool try_pop(T&);
+    std::optional<T> pop();
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "mpmcListImplementation.tpp"
+
+#endif
@@ -0,0 +1,280 @@
+#include "mpmcListHeader.hpp"
+
+/**
+ * @brief Returns the element stored in a slot.
+ *
+ * @return A pointer to the slot's element storage.
+ */
+template <typename T>
+T* MpmcList<T>::Slot::value() {
+    return std::launder(reinterpret_cast<T*>(storage));
+}
+
+/**
+ * @brief Constructs an empty segment with every slot marked empty.
+ */
+template <typename T>
+MpmcList<T>::Segment::Segment() : enqueue_index(0), dequeue_index(0), next(nullptr) {
+    for (Slot& slot : slots) {
+        slot.state.store(slot_empty, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Allocates a segment from the shared slab pool.
+ *
+ * @param bytes The size of the segment, always `sizeof(Segment)`.
+ * @return Storage for one segment.
+ */
+template <typename T>
+void* MpmcList<T>::Segment::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Segment), alignof(Segment)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a segment's storage to the shared slab pool.
+ *
+ * @param ptr The segment storage to release.
+ */
+template <typename T>
+void MpmcList<T>::Segment::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Segment), alignof(Segment)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Frees a segment retired through `EpochReclaimer`.
+ *
+ * A segment is only retired once every slot has been claimed by a consumer, so it holds no elements.
+ *
+ * @param segment The segment to free.
+ */
+template <typename T>
+void MpmcList<T>::Segment::reclaim(void* segment) {
+    delete static_cast<Segment*>(segment);
+}
+
+/**
+ * @brief Constructs an empty queue with one segment.
+ */
+template <typename T>
+MpmcList<T>::MpmcList() {
+    Segment* segment = new Segment();
+    head.store(segment, std::memory_order_relaxed);
+    tail.store(segment, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Destroys the remaining elements and frees the segments.
+ *
+ * Must not run concurrently with any other operation on the queue.
+ */
+template <typename T>
+MpmcList<T>::~MpmcList() {
+    Segment* segment = head.load(std::memory_order_acquire);
+    while (segment) {
+        for (Slot& slot : segment->slots) {
+            if (slot.state.load(std::memory_order_acquire) == slot_full) {
+                std::destroy_at(slot.value());
+            }
+        }
+        Segment* next = segment->next.load(std::memory_order_acquire);
+        delete segment;
+        segment = next;
+    }
+}
+
+/**
+ * @brief Moves an element into the queue.
+ *
+ * The fast path is a single fetch-and-add on the tail segment's enqueue index, which hands the
+ * producer its own slot. The element is constructed in the slot and published by switching the
+ * slot's state from empty to full. If a consumer gave up on the slot first, the element stays
+ * where it is and the producer moves it on to the next slot it is given. When the tail segment
+ * is full, the producer links a new segment with the element already in its first slot; a
+ * producer that loses that race keeps its segment as a staging area for the next attempt.
+ *
+ * @param value The element to move in. It is left moved-from.
+ * @throw std::bad_alloc if a new segment cannot be allocated. The element is then lost.
+ */
+template <typename T>
+void MpmcList<T>::enqueue(T&& value) {
+    EpochReclaimer::Guard guard;
+    T* source = std::addressof(value);
+    Segment* spare = nullptr;
+    auto move_to = [&](Slot& slot) {
+        ::new (static_cast<void*>(slot.storage)) T(std::move(*source));
+        if (source != std::addressof(value)) {
+            std::destroy_at(source);
+        }
+        source = slot.value();
+    };
+    for (;;) {
+        Segment* segment = tail.load(std::memory_order_acquire);
+        std::size_t index = segment->enqueue_index.fetch_add(1, std::memory_order_relaxed);
+        if (index < segment_slots) {
+            Slot& slot = segment->slots[index];
+            move_to(slot);
+            std::uint32_t expected = slot_empty;
+            if (slot.state.compare_exchange_strong(expected, slot_full, std::memory_order_release, std::memory_order_relaxed)) {
+                delete spare;
+                return;
+            }
+            continue;
+        }
+
+        Segment* next = segment->next.load(std::memory_order_acquire);
+        if (next) {
+            tail.compare_exchange_strong(segment, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+        if (!spare) {
+            spare = new Segment();
+        }
+        if (source != spare->slots[0].value()) {
+            move_to(spare->slots[0]);
+        }
+        spare->slots[0].state.store(slot_full, std::memory_order_relaxed);
+        spare->enqueue_index.store(1, std::memory_order_relaxed);
+        Segment* expected = nullptr;
+        if (segment->next.compare_exchange_strong(expected, spare, std::memory_order_release, std::memory_order_acquire)) {
+            tail.compare_exchange_strong(segment, spare, std::memory_order_release, std::memory_order_relaxed);
+            return;
+        }
+        spare->slots[0].state.store(slot_empty, std::memory_order_relaxed);
+        spare->enqueue_index.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Copies an element into the queue.
+ *
+ * Safe to call from any number of threads concurrently with other pushes and pops.
+ *
+ * @param value The element to copy.
+ */
+template <typename T>
+void MpmcList<T>::push(const T& value) {
+    enqueue(T(value));
+}
+
+/**
+ * @brief Moves an element into the queue.
+ *
+ * Safe to call from any number of threads concurrently with other pushes and pops.
+ *
+ * @param value The element to move.
+ */
+template <typename T>
+void MpmcList<T>::push(T&& value) {
+    enqueue(std::move(value));
+}
+
+/**
+ * @brief Constructs an element from the given arguments and moves it into the queue.
+ *
+ * @param args Arguments forwarded to the constructor of `T`.
+ */
+template <typename T>
+template <typename... Args>
+void MpmcList<T>::emplace(Args&&... args) {
+    enqueue(T(std::forward<Args>(args)...));
+}
+
+/**
+ * @brief Removes the oldest element, if any.
+ *
+ * The fast path is a single fetch-and-add on the head segment's dequeue index. The consumer then
+ * marks its slot taken; if the producer had not published the slot yet, the slot is abandoned and
+ * the consumer tries the next one. Once a segment's slots are all claimed, the head moves to the
+ * next segment, and the old one is freed through `EpochReclaimer` after every thread that might
+ * still be looking at it has moved on.
+ *
+ * Safe to call from any number of threads concurrently with other pushes and pops.
+ *
+ * @return The element, or an empty optional if the queue was empty.
+ */
+template <typename T>
+std::optional<T> MpmcList<T>::pop() {
+    EpochReclaimer::Guard guard;
+    for (;;) {
+        Segment* segment = head.load(std::memory_order_acquire);
+        if (segment->dequeue_index.load(std::memory_order_acquire) >= segment->enqueue_index.load(std::memory_order_acquire) &&
+            !segment->next.load(std::memory_order_acquire)) {
+            return std::nullopt;
+        }
+        std::size_t index = segment->dequeue_index.fetch_add(1, std::memory_order_relaxed);
+        if (index < segment_slots) {
+            Slot& slot = segment->slots[index];
+            if (slot.state.exchange(slot_taken, std::memory_order_acquire) == slot_full) {
+                std::optional<T> result(std::in_place, std::move(*slot.value()));
+                std::destroy_at(slot.value());
+                return result;
+            }
+            continue;
+        }
+
+        Segment* next = segment->next.load(std::memory_order_acquire);
+        if (!next) {
+            return std::nullopt;
+        }
+        Segment* last = segment;
+        tail.compare_exchange_strong(last, next, std::memory_order_release, std::memory_order_relaxed);
+        if (head.compare_exchange_strong(segment, next, std::memory_order_release, std::memory_order_relaxed)) {
+            EpochReclaimer::retire(segment, &Segment::reclaim);
+        }
+    }
+}
+
+/**
+ * @brief Removes the oldest element into an existing object, if any.
+ *
+ * @param out Receives the element by move assignment.
+ * @return True if an element was removed, false if the queue was empty.
+ */
+template <typename T>
+bool MpmcList<T>::try_pop(T& out) {
+    std::optional<T> value = pop();
+    if (!value) {
+        return false;
+    }
+    out = std::move(*value);
+    return true;
+}
+
+/**
+ * @brief Returns the number of elements in the queue.
+ *
+ * With concurrent pushes and pops the result is only a snapshot, and may count elements that are
+ * still being published or that were just taken.
+ *
+ * @return The approximate number of elements.
+ */
+template <typename T>
+typename MpmcList<T>::size_type MpmcList<T>::getSize() const {
+    EpochReclaimer::Guard guard;
+    size_type count = 0;
+    for (Segment* segment = head.load(std::memory_order_acquire); segment; segment = segment->next.load(std::memory_order_acquire)) {
+        size_type produced = std::min(segment->enqueue_index.load(std::memory_order_acquire), segment_slots);
+        size_type consumed = std::min(segment->dequeue_index.load(std::memory_order_acquire), segment_slots);
+        if (produced > consumed) {
+            count += produced - consumed;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Checks whether the queue is empty.
+ *
+ * With concurrent pushes and pops the result is only a snapshot.
+ *
+ * @return True if no element was waiting when the head segment was inspected.
+ */
+template <typename T>
+bool MpmcList<T>::empty() const {
+    EpochReclaimer::Guard guard;
+    Segment* segment = head.load(std::memory_order_acquire);
+    return segment->dequeue_index.load(std::memory_order_acquire) >= segment->enqueue_index.load(std::memory_order_acquire) &&
+           !segment->next.load(std::memory_order_acquire);
+}
@@ -0,0 +1,181 @@
+#ifndef NESTED_LIST_H
+#define NESTED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifndef NESTED_LIST_BLOCK_SIZE
+#define NESTED_LIST_BLOCK_SIZE 1024
+#endif
+
+template <typename T>
+class NestedList {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using index_type = std::uint32_t;
+    using group_id = index_type;
+
+    static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+    struct Flattened {
+        std::vector<size_type> offsets;
+        std::vector<T> values;
+    };
+
+private:
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        index_type next;
+        index_type prev;
+        T* value();
+        const T* value() const;
+    };
+
+    struct Group {
+        index_type head;
+        index_type tail;
+        index_type next;
+        index_type prev;
+        size_type size;
+        bool active;
+    };
+
+    static constexpr size_type block_size = NESTED_LIST_BLOCK_SIZE;
+    static_assert((block_size & (block_size - 1)) == 0, "NESTED_LIST_BLOCK_SIZE must be a power of two");
+
+    std::vector<std::unique_ptr<Slot[]>> blocks;
+    std::vector<Group> groups;
+    index_type slot_count;
+    index_type free_slot;
+    index_type free_group;
+    index_type first;
+    index_type last;
+    size_type live_groups;
+    size_type size;
+
+    Slot& slot(index_type);
+    const Slot& slot(index_type) const;
+    Group& group_at(group_id);
+    const Group& group_at(group_id) const;
+    index_type acquire_slot();
+    void release_slot(index_type);
+    void link_slot(Group&, index_type, index_type);
+    void unlink_slot(Group&, index_type);
+    void link_group(group_id, group_id);
+    void unlink_group(group_id);
+    void destroy_group_elements(Group&);
+
+public:
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator(NestedList*, group_id, index_type);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator& operator--();
+        iterator operator++(int);
+        iterator operator--(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+        friend class NestedList<T>;
+    private:
+        NestedList* owner;
+        group_id group;
+        index_type node;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = const T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator(const NestedList*, group_id, index_type);
+        const_iterator(const iterator&);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int);
+        const_iterator operator--(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+        friend class NestedList<T>;
+    private:
+        const NestedList* owner;
+        group_id group;
+        index_type node;
+    };
+
+    NestedList();
+    NestedList(const NestedList&) = delete;
+    NestedList& operator=(const NestedList&) = delete;
+    ~NestedList();
+
+    group_id add_group();
+    group_id insert_group(group_id);
+    void erase_group(group_id);
+    void move_group(group_id, group_id);
+    group_id first_group() const;
+    group_id last_group() const;
+    group_id next_group(group_id) const;
+    group_id prev_group(group_id) const;
+
+    void push_back(group_id, const T&);
+    void push_back(group_id, T&&);
+    void push_front(group_id, const T&);
+    void push_front(group_id, T&&);
+
+    template<typename... Args>
+    reference emplace_back(group_id, Args&&...);
+
+    template<typename... Args>
+    iterator emplace(const_iterator, Args&&...);
+
+    void pop_front(group_id);
+    void pop_back(group_id);
+    iterator erase(const_iterator);
+    reference front(group_id);
+    const_reference front(group_id) const;
+    reference back(group_id);
+    const_reference back(group_id) const;
+
+    void splice(const_iterator, const_iterator);
+    void splice(const_iterator, group_id);
+
+    iterator begin(group_id);
+    iterator end(group_id);
+    const_iterator cbegin(group_id) const;
+    const_iterator cend(group_id) const;
+
+    Flattened flatten() const;
+    void reserve(size_type);
+    void clear();
+    size_type group_size(group_id) const;
+    size_type group_count() const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "nestedListImplementation.tpp"
+
+#endif
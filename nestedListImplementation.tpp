@@ -0,0 +1,957 @@
+#include "nestedListHeader.hpp"
+
+/**
+ * @brief Returns the element stored in the slot's raw storage.
+ *
+ * @return A pointer to the slot's element; only valid while the slot is linked into a group.
+ */
+template <typename T>
+T* NestedList<T>::Slot::value() {
+    return std::launder(reinterpret_cast<T*>(storage));
+}
+
+/**
+ * @brief Returns the element stored in the slot's raw storage.
+ *
+ * @return A const pointer to the slot's element; only valid while the slot is linked into a group.
+ */
+template <typename T>
+const T* NestedList<T>::Slot::value() const {
+    return std::launder(reinterpret_cast<const T*>(storage));
+}
+
+/**
+ * @brief Resolves a slot index into the arena.
+ *
+ * Slots live in fixed-size blocks that are never reallocated, so element addresses stay stable
+ * while the arena grows.
+ *
+ * @param index The slot index.
+ * @return A reference to the slot.
+ */
+template <typename T>
+typename NestedList<T>::Slot& NestedList<T>::slot(index_type index) {
+    return blocks[index / block_size][index & (block_size - 1)];
+}
+
+/**
+ * @brief Resolves a slot index into the arena.
+ *
+ * @param index The slot index.
+ * @return A const reference to the slot.
+ */
+template <typename T>
+const typename NestedList<T>::Slot& NestedList<T>::slot(index_type index) const {
+    return blocks[index / block_size][index & (block_size - 1)];
+}
+
+/**
+ * @brief Looks up the header of a live group.
+ *
+ * @param id The group handle.
+ * @return A reference to the group header.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+typename NestedList<T>::Group& NestedList<T>::group_at(group_id id) {
+    if (id >= groups.size() || !groups[id].active) {
+        throw std::out_of_range("NestedList group does not exist");
+    }
+    return groups[id];
+}
+
+/**
+ * @brief Looks up the header of a live group.
+ *
+ * @param id The group handle.
+ * @return A const reference to the group header.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+const typename NestedList<T>::Group& NestedList<T>::group_at(group_id id) const {
+    if (id >= groups.size() || !groups[id].active) {
+        throw std::out_of_range("NestedList group does not exist");
+    }
+    return groups[id];
+}
+
+/**
+ * @brief Takes a slot from the arena's free list, growing the arena by one block if needed.
+ *
+ * @return The index of an unlinked slot with no element constructed in it.
+ * @throw std::length_error if the arena has exhausted the index space.
+ */
+template <typename T>
+typename NestedList<T>::index_type NestedList<T>::acquire_slot() {
+    if (free_slot != npos) {
+        index_type index = free_slot;
+        free_slot = slot(index).next;
+        return index;
+    }
+    if (slot_count == npos) {
+        throw std::length_error("NestedList arena is full");
+    }
+    if (slot_count == blocks.size() * block_size) {
+        blocks.push_back(std::make_unique_for_overwrite<Slot[]>(block_size));
+    }
+    return slot_count++;
+}
+
+/**
+ * @brief Returns a slot to the arena's free list.
+ *
+ * The element must already have been destroyed.
+ *
+ * @param index The slot to release.
+ */
+template <typename T>
+void NestedList<T>::release_slot(index_type index) {
+    slot(index).next = free_slot;
+    free_slot = index;
+}
+
+/**
+ * @brief Links a slot into a group before the given slot.
+ *
+ * @param group The group to link into.
+ * @param index The slot to link.
+ * @param before The slot to link in front of, or `npos` to append.
+ */
+template <typename T>
+void NestedList<T>::link_slot(Group& group, index_type index, index_type before) {
+    Slot& s = slot(index);
+    s.next = before;
+    s.prev = (before == npos) ? group.tail : slot(before).prev;
+    if (s.prev != npos) {
+        slot(s.prev).next = index;
+    }
+    else {
+        group.head = index;
+    }
+    if (before != npos) {
+        slot(before).prev = index;
+    }
+    else {
+        group.tail = index;
+    }
+    ++group.size;
+}
+
+/**
+ * @brief Unlinks a slot from its group without destroying its element.
+ *
+ * @param group The group the slot belongs to.
+ * @param index The slot to unlink.
+ */
+template <typename T>
+void NestedList<T>::unlink_slot(Group& group, index_type index) {
+    Slot& s = slot(index);
+    if (s.prev != npos) {
+        slot(s.prev).next = s.next;
+    }
+    else {
+        group.head = s.next;
+    }
+    if (s.next != npos) {
+        slot(s.next).prev = s.prev;
+    }
+    else {
+        group.tail = s.prev;
+    }
+    --group.size;
+}
+
+/**
+ * @brief Links a group header into the outer sequence before another group.
+ *
+ * @param id The group to link.
+ * @param before The group to link in front of, or `npos` to append.
+ */
+template <typename T>
+void NestedList<T>::link_group(group_id id, group_id before) {
+    Group& g = groups[id];
+    g.next = before;
+    g.prev = (before == npos) ? last : groups[before].prev;
+    if (g.prev != npos) {
+        groups[g.prev].next = id;
+    }
+    else {
+        first = id;
+    }
+    if (before != npos) {
+        groups[before].prev = id;
+    }
+    else {
+        last = id;
+    }
+}
+
+/**
+ * @brief Unlinks a group header from the outer sequence, leaving its elements in place.
+ *
+ * @param id The group to unlink.
+ */
+template <typename T>
+void NestedList<T>::unlink_group(group_id id) {
+    Group& g = groups[id];
+    if (g.prev != npos) {
+        groups[g.prev].next = g.next;
+    }
+    else {
+        first = g.next;
+    }
+    if (g.next != npos) {
+        groups[g.next].prev = g.prev;
+    }
+    else {
+        last = g.prev;
+    }
+}
+
+/**
+ * @brief Destroys every element of a group and returns its slots to the arena.
+ *
+ * @param group The group to empty.
+ */
+template <typename T>
+void NestedList<T>::destroy_group_elements(Group& group) {
+    index_type current = group.head;
+    while (current != npos) {
+        index_type next = slot(current).next;
+        std::destroy_at(slot(current).value());
+        release_slot(current);
+        current = next;
+    }
+    size -= group.size;
+    group.head = npos;
+    group.tail = npos;
+    group.size = 0;
+}
+
+/**
+ * @brief Constructor for an iterator, initializing it with a slot index.
+ *
+ * @param list The list the iterator belongs to.
+ * @param id The group being traversed.
+ * @param index The slot the iterator will reference, or `npos` for `end(id)`.
+ */
+template <typename T>
+NestedList<T>::iterator::iterator(NestedList* list, group_id id, index_type index) : owner(list), group(id), node(index) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A reference to the element in the current slot.
+ */
+template <typename T>
+typename NestedList<T>::iterator::reference NestedList<T>::iterator::operator*() const {
+    return *owner->slot(node).value();
+}
+
+/**
+ * @brief Arrow operator for iterator.
+ *
+ * @return A pointer to the element in the current slot.
+ */
+template <typename T>
+typename NestedList<T>::iterator::pointer NestedList<T>::iterator::operator->() const {
+    return owner->slot(node).value();
+}
+
+/**
+ * @brief Prefix increment operator for iterator, moving it to the next element of the group.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename NestedList<T>::iterator& NestedList<T>::iterator::operator++() {
+    node = owner->slot(node).next;
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for iterator; decrementing `end(id)` yields the group's last element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename NestedList<T>::iterator& NestedList<T>::iterator::operator--() {
+    node = (node == npos) ? owner->groups[group].tail : owner->slot(node).prev;
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename NestedList<T>::iterator NestedList<T>::iterator::operator++(int) {
+    iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename NestedList<T>::iterator NestedList<T>::iterator::operator--(int) {
+    iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators reference the same position of the same group, false otherwise.
+ */
+template <typename T>
+bool NestedList<T>::iterator::operator==(const iterator& other) const {
+    return node == other.node && group == other.group;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators reference different positions, false otherwise.
+ */
+template <typename T>
+bool NestedList<T>::iterator::operator!=(const iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructor for a const iterator, initializing it with a slot index.
+ *
+ * @param list The list the iterator belongs to.
+ * @param id The group being traversed.
+ * @param index The slot the iterator will reference, or `npos` for `cend(id)`.
+ */
+template <typename T>
+NestedList<T>::const_iterator::const_iterator(const NestedList* list, group_id id, index_type index) : owner(list), group(id), node(index) { }
+
+/**
+ * @brief Converts a mutable iterator to a const iterator at the same position.
+ *
+ * @param it The iterator to convert.
+ */
+template <typename T>
+NestedList<T>::const_iterator::const_iterator(const iterator& it) : owner(it.owner), group(it.group), node(it.node) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return A const reference to the element in the current slot.
+ */
+template <typename T>
+typename NestedList<T>::const_iterator::reference NestedList<T>::const_iterator::operator*() const {
+    return *owner->slot(node).value();
+}
+
+/**
+ * @brief Arrow operator for const iterator.
+ *
+ * @return A const pointer to the element in the current slot.
+ */
+template <typename T>
+typename NestedList<T>::const_iterator::pointer NestedList<T>::const_iterator::operator->() const {
+    return owner->slot(node).value();
+}
+
+/**
+ * @brief Prefix increment operator for const iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename NestedList<T>::const_iterator& NestedList<T>::const_iterator::operator++() {
+    node = owner->slot(node).next;
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for const iterator; decrementing `cend(id)` yields the group's last element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename NestedList<T>::const_iterator& NestedList<T>::const_iterator::operator--() {
+    node = (node == npos) ? owner->groups[group].tail : owner->slot(node).prev;
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename NestedList<T>::const_iterator NestedList<T>::const_iterator::operator++(int) {
+    const_iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for const iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename NestedList<T>::const_iterator NestedList<T>::const_iterator::operator--(int) {
+    const_iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators reference the same position of the same group, false otherwise.
+ */
+template <typename T>
+bool NestedList<T>::const_iterator::operator==(const const_iterator& other) const {
+    return node == other.node && group == other.group;
+}
+
+/**
+ * @brief Inequality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators reference different positions, false otherwise.
+ */
+template <typename T>
+bool NestedList<T>::const_iterator::operator!=(const const_iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructs an empty nested list with no groups and no arena blocks.
+ */
+template <typename T>
+NestedList<T>::NestedList()
+    : slot_count(0), free_slot(npos), free_group(npos), first(npos), last(npos), live_groups(0), size(0) { }
+
+/**
+ * @brief Destroys every element; the arena blocks are released with the list.
+ */
+template <typename T>
+NestedList<T>::~NestedList() {
+    for (group_id id = first; id != npos; id = groups[id].next) {
+        destroy_group_elements(groups[id]);
+    }
+}
+
+/**
+ * @brief Appends a new, empty group to the outer sequence.
+ *
+ * @return The handle of the new group.
+ */
+template <typename T>
+typename NestedList<T>::group_id NestedList<T>::add_group() {
+    return insert_group(npos);
+}
+
+/**
+ * @brief Inserts a new, empty group into the outer sequence before another group.
+ *
+ * Group headers are recycled from previously erased groups, so handles may be reused.
+ *
+ * @param before The group to insert in front of, or `npos` to append.
+ * @return The handle of the new group.
+ * @throw std::out_of_range if `before` is neither `npos` nor a live group.
+ * @throw std::length_error if the group index space is exhausted.
+ */
+template <typename T>
+typename NestedList<T>::group_id NestedList<T>::insert_group(group_id before) {
+    if (before != npos) {
+        group_at(before);
+    }
+    group_id id;
+    if (free_group != npos) {
+        id = free_group;
+        free_group = groups[id].next;
+    }
+    else {
+        if (groups.size() >= npos) {
+            throw std::length_error("NestedList has too many groups");
+        }
+        id = static_cast<group_id>(groups.size());
+        groups.push_back(Group{});
+    }
+    groups[id] = Group{npos, npos, npos, npos, 0, true};
+    link_group(id, before);
+    ++live_groups;
+    return id;
+}
+
+/**
+ * @brief Removes a group and all of its elements.
+ *
+ * @param id The group to remove.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::erase_group(group_id id) {
+    destroy_group_elements(group_at(id));
+    unlink_group(id);
+    groups[id].active = false;
+    groups[id].next = free_group;
+    free_group = id;
+    --live_groups;
+}
+
+/**
+ * @brief Moves a whole group, with its elements, to another position in the outer sequence in O(1).
+ *
+ * Only the group header is relinked; no element is touched.
+ *
+ * @param id The group to move.
+ * @param before The group to move it in front of, or `npos` to move it to the end.
+ * @throw std::out_of_range if either handle does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::move_group(group_id id, group_id before) {
+    group_at(id);
+    if (before != npos) {
+        group_at(before);
+    }
+    if (id == before) {
+        return;
+    }
+    unlink_group(id);
+    link_group(id, before);
+}
+
+/**
+ * @brief Returns the first group of the outer sequence.
+ *
+ * @return The handle of the first group, or `npos` if there are none.
+ */
+template <typename T>
+typename NestedList<T>::group_id NestedList<T>::first_group() const {
+    return first;
+}
+
+/**
+ * @brief Returns the last group of the outer sequence.
+ *
+ * @return The handle of the last group, or `npos` if there are none.
+ */
+template <typename T>
+typename NestedList<T>::group_id NestedList<T>::last_group() const {
+    return last;
+}
+
+/**
+ * @brief Returns the group that follows another in the outer sequence.
+ *
+ * @param id A live group.
+ * @return The handle of the next group, or `npos` after the last one.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+typename NestedList<T>::group_id NestedList<T>::next_group(group_id id) const {
+    return group_at(id).next;
+}
+
+/**
+ * @brief Returns the group that precedes another in the outer sequence.
+ *
+ * @param id A live group.
+ * @return The handle of the previous group, or `npos` before the first one.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+typename NestedList<T>::group_id NestedList<T>::prev_group(group_id id) const {
+    return group_at(id).prev;
+}
+
+/**
+ * @brief Appends an element to a group.
+ *
+ * @param id The group to append to.
+ * @param value The value to add.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::push_back(group_id id, const T& value) {
+    emplace(cend(id), value);
+}
+
+/**
+ * @brief Appends an r-value element to a group.
+ *
+ * @param id The group to append to.
+ * @param value The value to add.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::push_back(group_id id, T&& value) {
+    emplace(cend(id), std::move(value));
+}
+
+/**
+ * @brief Prepends an element to a group.
+ *
+ * @param id The group to prepend to.
+ * @param value The value to add.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::push_front(group_id id, const T& value) {
+    emplace(cbegin(id), value);
+}
+
+/**
+ * @brief Prepends an r-value element to a group.
+ *
+ * @param id The group to prepend to.
+ * @param value The value to add.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::push_front(group_id id, T&& value) {
+    emplace(cbegin(id), std::move(value));
+}
+
+/**
+ * @brief Constructs an element in place at the end of a group.
+ *
+ * @param id The group to append to.
+ * @param args The arguments to construct the new element.
+ * @return A reference to the new element.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+template<typename... Args>
+typename NestedList<T>::reference NestedList<T>::emplace_back(group_id id, Args&&... args) {
+    return *emplace(cend(id), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Constructs an element in place before the given position.
+ *
+ * The element is placed in the shared arena; if its constructor throws, the slot is returned
+ * and the list is unchanged.
+ *
+ * @param pos The position to insert before; `cend(id)` appends to the group.
+ * @param args The arguments to construct the new element.
+ * @return An iterator to the new element.
+ */
+template <typename T>
+template<typename... Args>
+typename NestedList<T>::iterator NestedList<T>::emplace(const_iterator pos, Args&&... args) {
+    index_type index = acquire_slot();
+    try {
+        ::new (static_cast<void*>(slot(index).storage)) T(std::forward<Args>(args)...);
+    }
+    catch (...) {
+        release_slot(index);
+        throw;
+    }
+    link_slot(groups[pos.group], index, pos.node);
+    ++size;
+    return iterator(this, pos.group, index);
+}
+
+/**
+ * @brief Removes the first element of a group; does nothing if the group is empty.
+ *
+ * @param id The group to pop from.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::pop_front(group_id id) {
+    const Group& g = group_at(id);
+    if (g.head != npos) {
+        erase(const_iterator(this, id, g.head));
+    }
+}
+
+/**
+ * @brief Removes the last element of a group; does nothing if the group is empty.
+ *
+ * @param id The group to pop from.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::pop_back(group_id id) {
+    const Group& g = group_at(id);
+    if (g.tail != npos) {
+        erase(const_iterator(this, id, g.tail));
+    }
+}
+
+/**
+ * @brief Removes the element at the given position and returns its slot to the arena.
+ *
+ * @param pos A valid element position.
+ * @return An iterator to the element that followed the removed one.
+ */
+template <typename T>
+typename NestedList<T>::iterator NestedList<T>::erase(const_iterator pos) {
+    index_type next = slot(pos.node).next;
+    unlink_slot(groups[pos.group], pos.node);
+    std::destroy_at(slot(pos.node).value());
+    release_slot(pos.node);
+    --size;
+    return iterator(this, pos.group, next);
+}
+
+/**
+ * @brief Accessor to the first element of a group.
+ *
+ * @param id The group to read.
+ * @return A reference to the group's first element.
+ * @throw std::out_of_range if `id` does not name a live group or the group is empty.
+ */
+template <typename T>
+typename NestedList<T>::reference NestedList<T>::front(group_id id) {
+    const Group& g = group_at(id);
+    if (g.head == npos) {
+        throw std::out_of_range("NestedList group is empty");
+    }
+    return *slot(g.head).value();
+}
+
+/**
+ * @brief Const accessor to the first element of a group.
+ *
+ * @param id The group to read.
+ * @return A const reference to the group's first element.
+ * @throw std::out_of_range if `id` does not name a live group or the group is empty.
+ */
+template <typename T>
+typename NestedList<T>::const_reference NestedList<T>::front(group_id id) const {
+    return const_cast<NestedList*>(this)->front(id);
+}
+
+/**
+ * @brief Accessor to the last element of a group.
+ *
+ * @param id The group to read.
+ * @return A reference to the group's last element.
+ * @throw std::out_of_range if `id` does not name a live group or the group is empty.
+ */
+template <typename T>
+typename NestedList<T>::reference NestedList<T>::back(group_id id) {
+    const Group& g = group_at(id);
+    if (g.tail == npos) {
+        throw std::out_of_range("NestedList group is empty");
+    }
+    return *slot(g.tail).value();
+}
+
+/**
+ * @brief Const accessor to the last element of a group.
+ *
+ * @param id The group to read.
+ * @return A const reference to the group's last element.
+ * @throw std::out_of_range if `id` does not name a live group or the group is empty.
+ */
+template <typename T>
+typename NestedList<T>::const_reference NestedList<T>::back(group_id id) const {
+    return const_cast<NestedList*>(this)->back(id);
+}
+
+/**
+ * @brief Moves a single element, possibly from another group, to before the given position in O(1).
+ *
+ * The element keeps its arena slot; only its links change, so references to it stay valid.
+ *
+ * @param pos The position to move the element in front of.
+ * @param element The element to move.
+ */
+template <typename T>
+void NestedList<T>::splice(const_iterator pos, const_iterator element) {
+    if (pos.node == element.node) {
+        return;
+    }
+    unlink_slot(groups[element.group], element.node);
+    link_slot(groups[pos.group], element.node, pos.node);
+}
+
+/**
+ * @brief Moves every element of a group to before the given position in O(1), leaving the source group empty.
+ *
+ * @param pos The position to move the elements in front of; it must not lie in `source`.
+ * @param source The group whose elements are moved.
+ * @throw std::out_of_range if `source` does not name a live group.
+ */
+template <typename T>
+void NestedList<T>::splice(const_iterator pos, group_id source) {
+    Group& src = group_at(source);
+    if (source == pos.group || src.head == npos) {
+        return;
+    }
+    Group& dst = groups[pos.group];
+    index_type before = (pos.node == npos) ? dst.tail : slot(pos.node).prev;
+    slot(src.head).prev = before;
+    if (before != npos) {
+        slot(before).next = src.head;
+    }
+    else {
+        dst.head = src.head;
+    }
+    slot(src.tail).next = pos.node;
+    if (pos.node != npos) {
+        slot(pos.node).prev = src.tail;
+    }
+    else {
+        dst.tail = src.tail;
+    }
+    dst.size += src.size;
+    src.head = npos;
+    src.tail = npos;
+    src.size = 0;
+}
+
+/**
+ * @brief Returns an iterator to the first element of a group.
+ *
+ * @param id The group to traverse.
+ * @return An iterator to the group's first element.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+typename NestedList<T>::iterator NestedList<T>::begin(group_id id) {
+    return iterator(this, id, group_at(id).head);
+}
+
+/**
+ * @brief Returns an iterator past the last element of a group.
+ *
+ * @param id The group to traverse.
+ * @return The group's end iterator.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+typename NestedList<T>::iterator NestedList<T>::end(group_id id) {
+    group_at(id);
+    return iterator(this, id, npos);
+}
+
+/**
+ * @brief Returns a constant iterator to the first element of a group.
+ *
+ * @param id The group to traverse.
+ * @return A constant iterator to the group's first element.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+typename NestedList<T>::const_iterator NestedList<T>::cbegin(group_id id) const {
+    return const_iterator(this, id, group_at(id).head);
+}
+
+/**
+ * @brief Returns a constant iterator past the last element of a group.
+ *
+ * @param id The group to traverse.
+ * @return The group's constant end iterator.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+typename NestedList<T>::const_iterator NestedList<T>::cend(group_id id) const {
+    group_at(id);
+    return const_iterator(this, id, npos);
+}
+
+/**
+ * @brief Copies the whole structure into compressed sparse row form for read-heavy phases.
+ *
+ * Group `i` (in outer order) occupies `values[offsets[i]]` up to, but not including,
+ * `values[offsets[i + 1]]`; `offsets` therefore has `group_count() + 1` entries.
+ *
+ * @return The offsets and the contiguous element array.
+ */
+template <typename T>
+typename NestedList<T>::Flattened NestedList<T>::flatten() const {
+    Flattened result;
+    result.offsets.reserve(live_groups + 1);
+    result.values.reserve(size);
+    result.offsets.push_back(0);
+    for (group_id id = first; id != npos; id = groups[id].next) {
+        for (index_type i = groups[id].head; i != npos; i = slot(i).next) {
+            result.values.push_back(*slot(i).value());
+        }
+        result.offsets.push_back(result.values.size());
+    }
+    return result;
+}
+
+/**
+ * @brief Grows the arena so that at least `count` elements fit without further block allocation.
+ *
+ * @param count The number of element slots to provide.
+ */
+template <typename T>
+void NestedList<T>::reserve(size_type count) {
+    while (blocks.size() * block_size < count) {
+        blocks.push_back(std::make_unique_for_overwrite<Slot[]>(block_size));
+    }
+}
+
+/**
+ * @brief Removes every group and element, keeping the arena blocks for reuse.
+ */
+template <typename T>
+void NestedList<T>::clear() {
+    for (group_id id = first; id != npos; id = groups[id].next) {
+        destroy_group_elements(groups[id]);
+    }
+    groups.clear();
+    free_group = npos;
+    first = npos;
+    last = npos;
+    live_groups = 0;
+}
+
+/**
+ * @brief Returns the number of elements in a group.
+ *
+ * @param id The group to query.
+ * @return The group's size.
+ * @throw std::out_of_range if `id` does not name a live group.
+ */
+template <typename T>
+typename NestedList<T>::size_type NestedList<T>::group_size(group_id id) const {
+    return group_at(id).size;
+}
+
+/**
+ * @brief Returns the number of groups in the outer sequence.
+ *
+ * @return The group count.
+ */
+template <typename T>
+typename NestedList<T>::size_type NestedList<T>::group_count() const {
+    return live_groups;
+}
+
+/**
+ * @brief Returns the total number of elements across all groups.
+ *
+ * @return The element count.
+ */
+template <typename T>
+typename NestedList<T>::size_type NestedList<T>::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Checks whether the list holds no elements.
+ *
+ * @return `true` if every group is empty or there are no groups, `false` otherwise.
+ */
+template <typename T>
+bool NestedList<T>::empty() const {
+    return size == 0;
+}
@@ -0,0 +1,153 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifndef NODE_POOL_SLAB_SIZE
+#define NODE_POOL_SLAB_SIZE (std::size_t(64) * 1024)
+#endif
+
+#ifndef NODE_POOL_THREAD_CACHE
+#define NODE_POOL_THREAD_CACHE 64
+#endif
+
+class NodePoolRegistry {
+public:
+    using trim_function = std::function<std::size_t(std::size_t)>;
+    using bytes_function = std::function<std::size_t()>;
+
+    static NodePoolRegistry& instance();
+    static std::size_t trim(std::size_t);
+    static std::size_t reserved_bytes();
+
+    void add(trim_function, bytes_function);
+
+private:
+    struct Entry {
+        trim_function trim;
+        bytes_function reserved;
+    };
+
+    NodePoolRegistry() = default;
+
+    std::mutex mutex;
+    std::vector<Entry> pools;
+};
+
+template <std::size_t Size, std::size_t Align>
+class NodePool {
+public:
+    static NodePool& instance();
+
+    void* allocate();
+    void deallocate(void*) noexcept;
+    std::size_t trim(std::size_t);
+    std::size_t reserved_bytes() const;
+    std::size_t used_bytes() const;
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+private:
+    struct Slab {
+        Slab* next;
+        Slab* prev;
+        void* free_list;
+        std::size_t live;
+        std::size_t bump;
+        bool available;
+    };
+
+    struct ThreadCache {
+        void* free_list;
+        std::size_t count;
+        bool registered;
+        bool closed;
+    };
+
+    struct CacheFlush {
+        ~CacheFlush();
+    };
+
+    static constexpr std::size_t slot_align = Align < alignof(void*) ? alignof(void*) : Align;
+    static constexpr std::size_t slot_size = ((Size < sizeof(void*) ? sizeof(void*) : Size) + slot_align - 1) / slot_align * slot_align;
+    static constexpr std::size_t first_slot = (sizeof(Slab) + slot_align - 1) / slot_align * slot_align;
+    static constexpr std::size_t slots_per_slab = (NODE_POOL_SLAB_SIZE - first_slot) / slot_size;
+#ifndef LIST_DISABLE_NODE_POOL
+    static constexpr bool pooled = slots_per_slab >= 8 && slot_align <= NODE_POOL_SLAB_SIZE / 8;
+#else
+    static constexpr bool pooled = false;
+#endif
+    static constexpr std::size_t cache_limit = NODE_POOL_THREAD_CACHE;
+
+    NodePool();
+
+    static Slab* slab_of(void*);
+    static void* map_slab();
+    static void unmap_slab(void*);
+    static ThreadCache& thread_cache();
+    void* take_slot();
+    void give_slot(void*) noexcept;
+    void refill(ThreadCache&);
+    void flush(ThreadCache&, std::size_t) noexcept;
+    void link_available(Slab*);
+    void unlink_available(Slab*);
+
+    mutable std::mutex mutex;
+    Slab* available_head;
+    Slab* available_tail;
+    std::size_t slab_count;
+    std::size_t live_slots;
+};
+
+class MemoryPressureWatcher {
+public:
+    struct Options {
+        std::chrono::milliseconds interval{1000};
+        double limit_fraction = 0.85;
+        std::size_t high_watermark_bytes = 0;
+        std::size_t target_pool_bytes = 0;
+    };
+
+    MemoryPressureWatcher();
+    explicit MemoryPressureWatcher(Options);
+    MemoryPressureWatcher(const MemoryPressureWatcher&) = delete;
+    MemoryPressureWatcher& operator=(const MemoryPressureWatcher&) = delete;
+    ~MemoryPressureWatcher();
+
+    std::size_t poll();
+    std::size_t trims() const;
+
+    static std::size_t current_usage_bytes();
+    static std::size_t memory_limit_bytes();
+
+private:
+    Options options;
+    std::atomic<std::size_t> trim_count;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping;
+    std::thread worker;
+
+    void run();
+    static std::size_t read_number(const char*);
+};
+
+#include "nodePoolImplementation.tpp"
+
+#endif
@@ -0,0 +1,589 @@
+#include "nodePoolHeader.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief Returns the process-wide registry of node pools.
+ *
+ * The registry is intentionally never destroyed so that lists with static storage duration
+ * can still free their nodes during program shutdown.
+ *
+ * @return The registry instance.
+ */
+inline NodePoolRegistry& NodePoolRegistry::instance() {
+    static NodePoolRegistry* registry = new NodePoolRegistry();
+    return *registry;
+}
+
+/**
+ * @brief Releases empty slabs from all pools until their combined footprint is at most `target_bytes`.
+ *
+ * Pools are visited in registration order; each one gives back as many of its empty slabs as
+ * are needed, and slabs still holding live nodes are never touched.
+ *
+ * @param target_bytes The combined reserved size to shrink towards.
+ * @return The number of bytes returned to the operating system.
+ */
+inline std::size_t NodePoolRegistry::trim(std::size_t target_bytes) {
+    NodePoolRegistry& registry = instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::size_t reserved = 0;
+    for (const Entry& entry : registry.pools) {
+        reserved += entry.reserved();
+    }
+    std::size_t released = 0;
+    for (const Entry& entry : registry.pools) {
+        if (reserved - released <= target_bytes) {
+            break;
+        }
+        std::size_t excess = reserved - released - target_bytes;
+        std::size_t own = entry.reserved();
+        released += entry.trim(own > excess ? own - excess : 0);
+    }
+    return released;
+}
+
+/**
+ * @brief Returns the combined size of all slabs currently mapped by the pools.
+ *
+ * @return The reserved size in bytes.
+ */
+inline std::size_t NodePoolRegistry::reserved_bytes() {
+    NodePoolRegistry& registry = instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::size_t reserved = 0;
+    for (const Entry& entry : registry.pools) {
+        reserved += entry.reserved();
+    }
+    return reserved;
+}
+
+/**
+ * @brief Registers a pool so that global trims and the memory-pressure watcher can reach it.
+ *
+ * @param trim Callable releasing empty slabs down to a byte target and returning the bytes released.
+ * @param reserved Callable returning the pool's current reserved size.
+ */
+inline void NodePoolRegistry::add(trim_function trim, bytes_function reserved) {
+    std::lock_guard<std::mutex> lock(mutex);
+    pools.push_back(Entry{std::move(trim), std::move(reserved)});
+}
+
+/**
+ * @brief Returns the pool serving allocations of `Size` bytes aligned to `Align`.
+ *
+ * All node types with the same size and alignment share one pool. Like the registry, the
+ * pool is never destroyed.
+ *
+ * @return The pool instance.
+ */
+template <std::size_t Size, std::size_t Align>
+NodePool<Size, Align>& NodePool<Size, Align>::instance() {
+    static NodePool* pool = new NodePool();
+    return *pool;
+}
+
+/**
+ * @brief Constructs an empty pool and registers it for trimming.
+ */
+template <std::size_t Size, std::size_t Align>
+NodePool<Size, Align>::NodePool() : available_head(nullptr), available_tail(nullptr), slab_count(0), live_slots(0) {
+    NodePoolRegistry::instance().add(
+        [this](std::size_t target) { return trim(target); },
+        [this]() { return reserved_bytes(); });
+}
+
+/**
+ * @brief Allocates one slot.
+ *
+ * Each thread keeps up to `NODE_POOL_THREAD_CACHE` free slots of its own, so most allocations
+ * never touch the pool's mutex; an empty cache is refilled with a batch taken under one lock.
+ * Defining `NODE_POOL_THREAD_CACHE` as 0 sends every call to the shared slabs. Types too large or
+ * too strictly aligned to fit several slots per slab, and every type when `LIST_DISABLE_NODE_POOL`
+ * is defined, fall through to the global allocator.
+ *
+ * @return Storage for one object of `Size` bytes.
+ * @throw std::bad_alloc if no memory is available.
+ */
+template <std::size_t Size, std::size_t Align>
+void* NodePool<Size, Align>::allocate() {
+    if constexpr (!pooled) {
+        return ::operator new(Size, std::align_val_t(slot_align));
+    }
+    else {
+        if constexpr (cache_limit > 0) {
+            ThreadCache& cache = thread_cache();
+            if (!cache.closed) {
+                if (!cache.free_list) {
+                    refill(cache);
+                }
+                void* slot = cache.free_list;
+                cache.free_list = *static_cast<void**>(slot);
+                --cache.count;
+                return slot;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        return take_slot();
+    }
+}
+
+/**
+ * @brief Returns a slot to the calling thread's cache, or to its slab once the cache is full.
+ *
+ * An overfull cache hands half of its slots back under one lock. Slots may be released by a
+ * different thread than the one that allocated them.
+ *
+ * @param ptr A pointer obtained from `allocate()`.
+ */
+template <std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::deallocate(void* ptr) noexcept {
+    if constexpr (!pooled) {
+        ::operator delete(ptr, std::align_val_t(slot_align));
+    }
+    else {
+        if constexpr (cache_limit > 0) {
+            ThreadCache& cache = thread_cache();
+            if (!cache.closed) {
+                *static_cast<void**>(ptr) = cache.free_list;
+                cache.free_list = ptr;
+                if (++cache.count > cache_limit) {
+                    flush(cache, cache_limit / 2);
+                }
+                return;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        give_slot(ptr);
+    }
+}
+
+/**
+ * @brief Returns the calling thread's slot cache for this pool.
+ *
+ * The cache itself is trivially destructible, so it stays usable while other thread-local and
+ * static objects are destroyed. A separate guard, registered on first use, hands the cached slots
+ * back when the thread exits and closes the cache, after which the thread uses the shared slabs.
+ *
+ * @return The cache of the calling thread.
+ */
+template <std::size_t Size, std::size_t Align>
+typename NodePool<Size, Align>::ThreadCache& NodePool<Size, Align>::thread_cache() {
+    static thread_local constinit ThreadCache cache{nullptr, 0, false, false};
+    if (!cache.registered) {
+        cache.registered = true;
+        static thread_local CacheFlush guard;
+        (void)guard;
+    }
+    return cache;
+}
+
+/**
+ * @brief Hands the exiting thread's cached slots back to their slabs and closes the cache.
+ */
+template <std::size_t Size, std::size_t Align>
+NodePool<Size, Align>::CacheFlush::~CacheFlush() {
+    ThreadCache& cache = thread_cache();
+    instance().flush(cache, 0);
+    cache.closed = true;
+}
+
+/**
+ * @brief Takes one slot from the shared slabs; the caller must hold the mutex.
+ *
+ * Slots come from the free list or the untouched tail of the first slab with room; a new slab is
+ * mapped only when every slab is full.
+ *
+ * @return A free slot.
+ * @throw std::bad_alloc if a new slab is needed and cannot be mapped.
+ */
+template <std::size_t Size, std::size_t Align>
+void* NodePool<Size, Align>::take_slot() {
+    if (!available_head) {
+        Slab* fresh = static_cast<Slab*>(map_slab());
+        fresh->next = fresh->prev = nullptr;
+        fresh->free_list = nullptr;
+        fresh->live = 0;
+        fresh->bump = 0;
+        fresh->available = false;
+        link_available(fresh);
+        ++slab_count;
+    }
+    Slab* slab = available_head;
+    void* slot;
+    if (slab->free_list) {
+        slot = slab->free_list;
+        slab->free_list = *static_cast<void**>(slot);
+    }
+    else {
+        slot = reinterpret_cast<unsigned char*>(slab) + first_slot + slab->bump * slot_size;
+        ++slab->bump;
+    }
+    if (++slab->live == slots_per_slab) {
+        unlink_available(slab);
+    }
+    ++live_slots;
+    return slot;
+}
+
+/**
+ * @brief Returns one slot to the slab it came from; the caller must hold the mutex.
+ *
+ * A slab that becomes completely empty is moved to the back of the available list, so new
+ * allocations keep filling partially used slabs and empty ones can be trimmed.
+ *
+ * @param ptr A slot obtained from `take_slot()`.
+ */
+template <std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::give_slot(void* ptr) noexcept {
+    Slab* slab = slab_of(ptr);
+    *static_cast<void**>(ptr) = slab->free_list;
+    slab->free_list = ptr;
+    --live_slots;
+    if (slab->live-- == slots_per_slab) {
+        link_available(slab);
+    }
+    else if (slab->live == 0 && slab != available_tail) {
+        unlink_available(slab);
+        link_available(slab);
+    }
+}
+
+/**
+ * @brief Fills an empty thread cache with up to half its capacity under a single lock.
+ *
+ * Only the first slot may map a new slab; the rest are taken while slabs with room remain, so a
+ * refill never maps memory just to park it in a cache.
+ *
+ * @param cache The calling thread's cache.
+ * @throw std::bad_alloc if not even one slot is available.
+ */
+template <std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::refill(ThreadCache& cache) {
+    std::size_t batch = cache_limit / 2 > 0 ? cache_limit / 2 : 1;
+    std::lock_guard<std::mutex> lock(mutex);
+    do {
+        void* slot = take_slot();
+        *static_cast<void**>(slot) = cache.free_list;
+        cache.free_list = slot;
+        ++cache.count;
+    } while (cache.count < batch && available_head);
+}
+
+/**
+ * @brief Hands cached slots back to their slabs under a single lock until `keep` remain.
+ *
+ * @param cache The calling thread's cache.
+ * @param keep The number of slots to leave in the cache.
+ */
+template <std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::flush(ThreadCache& cache, std::size_t keep) noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    while (cache.count > keep) {
+        void* slot = cache.free_list;
+        cache.free_list = *static_cast<void**>(slot);
+        --cache.count;
+        give_slot(slot);
+    }
+}
+
+/**
+ * @brief Unmaps empty slabs until the pool reserves at most `target_bytes`.
+ *
+ * @param target_bytes The reserved size to shrink towards.
+ * @return The number of bytes returned to the operating system.
+ */
+template <std::size_t Size, std::size_t Align>
+std::size_t NodePool<Size, Align>::trim(std::size_t target_bytes) {
+    if constexpr (!pooled) {
+        return 0;
+    }
+    else {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::size_t released = 0;
+        Slab* slab = available_tail;
+        while (slab && slab_count * NODE_POOL_SLAB_SIZE > target_bytes) {
+            Slab* previous = slab->prev;
+            if (slab->live == 0) {
+                unlink_available(slab);
+                unmap_slab(slab);
+                --slab_count;
+                released += NODE_POOL_SLAB_SIZE;
+            }
+            slab = previous;
+        }
+        return released;
+    }
+}
+
+/**
+ * @brief Returns the size of all slabs currently mapped by this pool.
+ *
+ * @return The reserved size in bytes.
+ */
+template <std::size_t Size, std::size_t Align>
+std::size_t NodePool<Size, Align>::reserved_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return slab_count * NODE_POOL_SLAB_SIZE;
+}
+
+/**
+ * @brief Returns the number of bytes occupied by live slots.
+ *
+ * Slots parked in thread caches count as used until they are handed back.
+ *
+ * @return The used size in bytes.
+ */
+template <std::size_t Size, std::size_t Align>
+std::size_t NodePool<Size, Align>::used_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return live_slots * slot_size;
+}
+
+/**
+ * @brief Finds the slab header of a slot from its address.
+ *
+ * Slabs are mapped at `NODE_POOL_SLAB_SIZE` alignment, so masking the low bits is enough.
+ *
+ * @param ptr A slot inside the slab.
+ * @return The slab containing the slot.
+ */
+template <std::size_t Size, std::size_t Align>
+typename NodePool<Size, Align>::Slab* NodePool<Size, Align>::slab_of(void* ptr) {
+    return reinterpret_cast<Slab*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(std::uintptr_t(NODE_POOL_SLAB_SIZE) - 1));
+}
+
+/**
+ * @brief Maps a new slab aligned to its own size.
+ *
+ * On POSIX systems twice the slab size is mapped and the misaligned ends are unmapped again, so
+ * the slab can later be returned to the kernel with `munmap`.
+ *
+ * @return The start of the new slab.
+ * @throw std::bad_alloc if the mapping fails.
+ */
+template <std::size_t Size, std::size_t Align>
+void* NodePool<Size, Align>::map_slab() {
+#if defined(__unix__) || defined(__APPLE__)
+    std::size_t span = NODE_POOL_SLAB_SIZE * 2;
+    void* raw = ::mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(raw);
+    std::uintptr_t aligned = (start + NODE_POOL_SLAB_SIZE - 1) & ~(std::uintptr_t(NODE_POOL_SLAB_SIZE) - 1);
+    if (aligned > start) {
+        ::munmap(raw, aligned - start);
+    }
+    std::uintptr_t end = start + span;
+    if (end > aligned + NODE_POOL_SLAB_SIZE) {
+        ::munmap(reinterpret_cast<void*>(aligned + NODE_POOL_SLAB_SIZE), end - aligned - NODE_POOL_SLAB_SIZE);
+    }
+    return reinterpret_cast<void*>(aligned);
+#else
+    return ::operator new(NODE_POOL_SLAB_SIZE, std::align_val_t(NODE_POOL_SLAB_SIZE));
+#endif
+}
+
+/**
+ * @brief Returns a slab's memory to the operating system.
+ *
+ * @param slab The slab to release; it must not contain live slots.
+ */
+template <std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::unmap_slab(void* slab) {
+#if defined(__unix__) || defined(__APPLE__)
+    ::munmap(slab, NODE_POOL_SLAB_SIZE);
+#else
+    ::operator delete(slab, std::align_val_t(NODE_POOL_SLAB_SIZE));
+#endif
+}
+
+/**
+ * @brief Appends a slab with free slots to the available list.
+ *
+ * Empty slabs go to the back and partially used ones to the front, so allocations prefer
+ * slabs that are already in use.
+ *
+ * @param slab The slab to link.
+ */
+template <std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::link_available(Slab* slab) {
+    slab->available = true;
+    if (slab->live == 0 || !available_head) {
+        slab->next = nullptr;
+        slab->prev = available_tail;
+        if (available_tail) {
+            available_tail->next = slab;
+        }
+        else {
+            available_head = slab;
+        }
+        available_tail = slab;
+    }
+    else {
+        slab->prev = nullptr;
+        slab->next = available_head;
+        available_head->prev = slab;
+        available_head = slab;
+    }
+}
+
+/**
+ * @brief Removes a slab from the available list.
+ *
+ * @param slab The slab to unlink.
+ */
+template <std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::unlink_available(Slab* slab) {
+    if (slab->prev) {
+        slab->prev->next = slab->next;
+    }
+    else {
+        available_head = slab->next;
+    }
+    if (slab->next) {
+        slab->next->prev = slab->prev;
+    }
+    else {
+        available_tail = slab->prev;
+    }
+    slab->next = slab->prev = nullptr;
+    slab->available = false;
+}
+
+/**
+ * @brief Constructs a watcher with the default options.
+ *
+ * Pools are trimmed completely once usage crosses 85% of the cgroup memory limit.
+ */
+inline MemoryPressureWatcher::MemoryPressureWatcher() : MemoryPressureWatcher(Options{}) { }
+
+/**
+ * @brief Starts a background thread that trims the node pools under memory pressure.
+ *
+ * Every `interval`, the watcher reads the current usage. It is under pressure if the usage exceeds
+ * `high_watermark_bytes` (when nonzero), or `limit_fraction` of the cgroup memory limit (when a
+ * limit is set). Under pressure, all pools are trimmed down to `target_pool_bytes`.
+ *
+ * @param opts The polling interval, thresholds and trim target.
+ */
+inline MemoryPressureWatcher::MemoryPressureWatcher(Options opts) : options(opts), trim_count(0), stopping(false) {
+    worker = std::thread([this] { run(); });
+}
+
+/**
+ * @brief Stops and joins the background thread.
+ */
+inline MemoryPressureWatcher::~MemoryPressureWatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    worker.join();
+}
+
+/**
+ * @brief Checks memory usage once and trims the pools if a threshold is crossed.
+ *
+ * @return The number of bytes released, or 0 if there was no pressure.
+ */
+inline std::size_t MemoryPressureWatcher::poll() {
+    std::size_t usage = current_usage_bytes();
+    bool pressure = false;
+    if (options.high_watermark_bytes && usage > options.high_watermark_bytes) {
+        pressure = true;
+    }
+    std::size_t limit = memory_limit_bytes();
+    if (limit && usage > static_cast<std::size_t>(static_cast<double>(limit) * options.limit_fraction)) {
+        pressure = true;
+    }
+    if (!pressure) {
+        return 0;
+    }
+    trim_count.fetch_add(1, std::memory_order_relaxed);
+    return NodePoolRegistry::trim(options.target_pool_bytes);
+}
+
+/**
+ * @brief Returns how many times the watcher has trimmed the pools.
+ *
+ * @return The number of trims performed.
+ */
+inline std::size_t MemoryPressureWatcher::trims() const {
+    return trim_count.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Reads the memory currently charged to this process.
+ *
+ * Prefers the cgroup v2 `memory.current` file, then cgroup v1 `memory.usage_in_bytes`, then the
+ * resident set size from `/proc/self/statm`.
+ *
+ * @return The usage in bytes, or 0 if none of the sources is readable.
+ */
+inline std::size_t MemoryPressureWatcher::current_usage_bytes() {
+    if (std::size_t usage = read_number("/sys/fs/cgroup/memory.current")) {
+        return usage;
+    }
+    if (std::size_t usage = read_number("/sys/fs/cgroup/memory/memory.usage_in_bytes")) {
+        return usage;
+    }
+#if defined(__unix__)
+    if (std::FILE* file = std::fopen("/proc/self/statm", "r")) {
+        unsigned long long total_pages = 0;
+        unsigned long long resident_pages = 0;
+        int fields = std::fscanf(file, "%llu %llu", &total_pages, &resident_pages);
+        std::fclose(file);
+        if (fields == 2) {
+            return static_cast<std::size_t>(resident_pages) * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        }
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief Reads the cgroup memory limit of this process.
+ *
+ * @return The limit in bytes, or 0 if there is no limit or it cannot be read.
+ */
+inline std::size_t MemoryPressureWatcher::memory_limit_bytes() {
+    if (std::size_t limit = read_number("/sys/fs/cgroup/memory.max")) {
+        return limit;
+    }
+    std::size_t limit = read_number("/sys/fs/cgroup/memory/memory.limit_in_bytes");
+    return limit >= (std::size_t(1) << 60) ? 0 : limit;
+}
+
+/**
+ * @brief Polls memory usage every interval until the watcher is destroyed.
+ */
+inline void MemoryPressureWatcher::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        lock.unlock();
+        poll();
+        lock.lock();
+        wake.wait_for(lock, options.interval, [this] { return stopping; });
+    }
+}
+
+/**
+ * @brief Reads a single unsigned number from a file.
+ *
+ * @param path The file to read.
+ * @return The number, or 0 if the file is missing or does not start with a number (such as "max").
+ */
+inline std::size_t MemoryPressureWatcher::read_number(const char* path) {
+    std::FILE* file = std::fopen(path, "r");
+    if (!file) {
+        return 0;
+    }
+    unsigned long long value = 0;
+    int fields = std::fscanf(file, "%llu", &value);
+    std::fclose(file);
+    return fields == 1 ? static_cast<std::size_t>(value) : 0;
+}
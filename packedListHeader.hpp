@@ -0,0 +1,150 @@
+#ifndef PACKED_LIST_H
+#define PACKED_LIST_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "nodePoolHeader.hpp"
+
+#ifndef PACKED_LIST_CHUNK_WORDS
+#define PACKED_LIST_CHUNK_WORDS 8
+#endif
+
+template <typename T>
+class PackedList {
+    static_assert(std::is_same_v<T, bool> || std::is_same_v<T, std::uint8_t> || std::is_same_v<T, std::uint16_t>,
+                  "PackedList supports bool, std::uint8_t and std::uint16_t");
+
+private:
+    static constexpr std::size_t chunk_words = PACKED_LIST_CHUNK_WORDS;
+    static constexpr std::size_t lane_bits = std::is_same_v<T, bool> ? 1 : 8 * sizeof(T);
+    static constexpr std::size_t lanes_per_word = 64 / lane_bits;
+    static constexpr std::size_t chunk_capacity = chunk_words * lanes_per_word;
+    static constexpr std::uint64_t lane_mask = (std::uint64_t(1) << lane_bits) - 1;
+
+    struct Chunk {
+        std::uint64_t words[chunk_words];
+        Chunk* next;
+        Chunk* prev;
+        std::uint16_t begin;
+        std::uint16_t count;
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+    };
+
+    Chunk* head;
+    Chunk* tail;
+    std::size_t size;
+
+    static T get(const Chunk*, std::size_t);
+    static void set(Chunk*, std::size_t, T);
+    static std::uint64_t extract(const Chunk*, std::size_t, std::size_t);
+    static std::uint64_t matches(std::uint64_t, T);
+    static std::uint64_t lanes(std::size_t);
+    Chunk* new_chunk_after(Chunk*, std::uint16_t);
+    void free_chunk(Chunk*);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = T;
+
+    class reference {
+    public:
+        reference(Chunk*, std::size_t);
+        operator T() const;
+        reference& operator=(T);
+        reference& operator=(const reference&);
+    private:
+        Chunk* chunk;
+        std::size_t lane;
+    };
+
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = PackedList::reference;
+
+        iterator(const PackedList*, Chunk*, std::size_t);
+        reference operator*() const;
+        iterator& operator++();
+        iterator& operator--();
+        iterator operator++(int);
+        iterator operator--(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+        friend class PackedList<T>;
+    private:
+        const PackedList* owner;
+        Chunk* chunk;
+        std::size_t index;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        const_iterator(const PackedList*, const Chunk*, std::size_t);
+        reference operator*() const;
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int);
+        const_iterator operator--(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+    private:
+        const PackedList* owner;
+        const Chunk* chunk;
+        std::size_t index;
+    };
+
+    PackedList();
+    PackedList(std::initializer_list<T>);
+    PackedList(const PackedList&);
+    PackedList& operator=(const PackedList&);
+    ~PackedList();
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    void push_back(T);
+    void push_front(T);
+    void pop_back();
+    void pop_front();
+    iterator insert(iterator, T);
+    iterator erase(iterator);
+    void clear();
+    void shrink_to_fit();
+    void swap(PackedList&) noexcept;
+
+    iterator begin();
+    iterator end();
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+    size_type count(T) const;
+    size_type popcount() const;
+    bool operator==(const PackedList&) const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "packedListImplementation.tpp"
+
+#endif
@@ -0,0 +1,843 @@
+#include "packedListHeader.hpp"
+
+/**
+ * @brief Allocates a chunk from the shared slab pool.
+ *
+ * @param bytes The size of the chunk, always `sizeof(Chunk)`.
+ * @return Storage for one chunk.
+ */
+template <typename T>
+void* PackedList<T>::Chunk::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Chunk), alignof(Chunk)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a chunk's storage to the shared slab pool.
+ *
+ * @param ptr The chunk storage to release.
+ */
+template <typename T>
+void PackedList<T>::Chunk::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Chunk), alignof(Chunk)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Reads the element stored in a lane of a chunk.
+ *
+ * @param chunk The chunk to read.
+ * @param lane The physical lane, counted from the start of the chunk's words.
+ * @return The element.
+ */
+template <typename T>
+T PackedList<T>::get(const Chunk* chunk, std::size_t lane) {
+    std::size_t shift = (lane % lanes_per_word) * lane_bits;
+    return static_cast<T>((chunk->words[lane / lanes_per_word] >> shift) & lane_mask);
+}
+
+/**
+ * @brief Writes an element into a lane of a chunk.
+ *
+ * @param chunk The chunk to write.
+ * @param lane The physical lane, counted from the start of the chunk's words.
+ * @param value The element to store.
+ */
+template <typename T>
+void PackedList<T>::set(Chunk* chunk, std::size_t lane, T value) {
+    std::size_t shift = (lane % lanes_per_word) * lane_bits;
+    std::uint64_t& word = chunk->words[lane / lanes_per_word];
+    word = (word & ~(lane_mask << shift)) | (static_cast<std::uint64_t>(value) << shift);
+}
+
+/**
+ * @brief Returns a mask covering the low `n` lanes of a word.
+ *
+ * @param n The number of lanes, at most `lanes_per_word`.
+ * @return The lane mask.
+ */
+template <typename T>
+std::uint64_t PackedList<T>::lanes(std::size_t n) {
+    return n * lane_bits >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (n * lane_bits)) - 1;
+}
+
+/**
+ * @brief Gathers up to one word's worth of consecutive lanes, starting at any lane, into the low bits of a word.
+ *
+ * The lanes may straddle two storage words; lanes beyond `n` are cleared so that blocks from
+ * chunks with different layouts can be compared directly.
+ *
+ * @param chunk The chunk to read.
+ * @param lane The first physical lane.
+ * @param n The number of lanes, at most `lanes_per_word`.
+ * @return The packed lanes.
+ */
+template <typename T>
+std::uint64_t PackedList<T>::extract(const Chunk* chunk, std::size_t lane, std::size_t n) {
+    std::size_t word = lane / lanes_per_word;
+    std::size_t shift = (lane % lanes_per_word) * lane_bits;
+    std::uint64_t bits = chunk->words[word] >> shift;
+    if (shift && shift + n * lane_bits > 64) {
+        bits |= chunk->words[word + 1] << (64 - shift);
+    }
+    return bits & lanes(n);
+}
+
+/**
+ * @brief Marks every lane of a word that equals `value`.
+ *
+ * For `bool` each matching lane is its own bit. For wider lanes the usual SWAR zero-lane test is
+ * applied to `word ^ broadcast(value)`, leaving the top bit of each matching lane set.
+ *
+ * @param word The packed lanes.
+ * @param value The value to look for.
+ * @return A word with one bit set per matching lane.
+ */
+template <typename T>
+std::uint64_t PackedList<T>::matches(std::uint64_t word, T value) {
+    constexpr std::uint64_t ones = ~std::uint64_t(0) / lane_mask;
+    std::uint64_t diff = word ^ (static_cast<std::uint64_t>(value) * ones);
+    if constexpr (lane_bits == 1) {
+        return ~diff;
+    }
+    else {
+        constexpr std::uint64_t low = ones * (lane_mask >> 1);
+        constexpr std::uint64_t high = ones * (std::uint64_t(1) << (lane_bits - 1));
+        return ~(((diff & low) + low) | diff) & high;
+    }
+}
+
+/**
+ * @brief Allocates an empty chunk and links it after another chunk.
+ *
+ * @param prev The chunk to link after, or nullptr to link at the front.
+ * @param begin The physical lane where the chunk's first element will be stored.
+ * @return The new chunk.
+ */
+template <typename T>
+typename PackedList<T>::Chunk* PackedList<T>::new_chunk_after(Chunk* prev, std::uint16_t begin) {
+    Chunk* chunk = new Chunk;
+    for (std::size_t i = 0; i < chunk_words; ++i) {
+        chunk->words[i] = 0;
+    }
+    chunk->begin = begin;
+    chunk->count = 0;
+    chunk->prev = prev;
+    chunk->next = prev ? prev->next : head;
+    if (chunk->next) {
+        chunk->next->prev = chunk;
+    }
+    else {
+        tail = chunk;
+    }
+    if (prev) {
+        prev->next = chunk;
+    }
+    else {
+        head = chunk;
+    }
+    return chunk;
+}
+
+/**
+ * @brief Unlinks and frees a chunk.
+ *
+ * @param chunk The chunk to free.
+ */
+template <typename T>
+void PackedList<T>::free_chunk(Chunk* chunk) {
+    if (chunk->prev) {
+        chunk->prev->next = chunk->next;
+    }
+    else {
+        head = chunk->next;
+    }
+    if (chunk->next) {
+        chunk->next->prev = chunk->prev;
+    }
+    else {
+        tail = chunk->prev;
+    }
+    delete chunk;
+}
+
+/**
+ * @brief Constructs a proxy for one packed element.
+ *
+ * @param owner The chunk holding the element.
+ * @param index The element's physical lane.
+ */
+template <typename T>
+PackedList<T>::reference::reference(Chunk* owner, std::size_t index) : chunk(owner), lane(index) { }
+
+/**
+ * @brief Reads the referenced element.
+ *
+ * @return The element's value.
+ */
+template <typename T>
+PackedList<T>::reference::operator T() const {
+    return get(chunk, lane);
+}
+
+/**
+ * @brief Overwrites the referenced element.
+ *
+ * @param value The new value.
+ * @return A reference to this proxy.
+ */
+template <typename T>
+typename PackedList<T>::reference& PackedList<T>::reference::operator=(T value) {
+    set(chunk, lane, value);
+    return *this;
+}
+
+/**
+ * @brief Copies the value of another referenced element into this one.
+ *
+ * @param other The proxy to read from.
+ * @return A reference to this proxy.
+ */
+template <typename T>
+typename PackedList<T>::reference& PackedList<T>::reference::operator=(const reference& other) {
+    return *this = static_cast<T>(other);
+}
+
+/**
+ * @brief Constructor for an iterator.
+ *
+ * @param list The list the iterator belongs to, used to step back from `end()`.
+ * @param c The chunk holding the element, or nullptr for `end()`.
+ * @param i The element's logical index within the chunk.
+ */
+template <typename T>
+PackedList<T>::iterator::iterator(const PackedList* list, Chunk* c, std::size_t i) : owner(list), chunk(c), index(i) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A proxy reference to the current element.
+ */
+template <typename T>
+typename PackedList<T>::iterator::reference PackedList<T>::iterator::operator*() const {
+    return reference(chunk, chunk->begin + index);
+}
+
+/**
+ * @brief Prefix increment operator for iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename PackedList<T>::iterator& PackedList<T>::iterator::operator++() {
+    if (++index == chunk->count) {
+        chunk = chunk->next;
+        index = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for iterator; decrementing `end()` yields the last element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename PackedList<T>::iterator& PackedList<T>::iterator::operator--() {
+    if (!chunk || index == 0) {
+        chunk = chunk ? chunk->prev : owner->tail;
+        index = chunk->count - 1;
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename PackedList<T>::iterator PackedList<T>::iterator::operator++(int) {
+    iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename PackedList<T>::iterator PackedList<T>::iterator::operator--(int) {
+    iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators reference the same element, false otherwise.
+ */
+template <typename T>
+bool PackedList<T>::iterator::operator==(const iterator& other) const {
+    return chunk == other.chunk && index == other.index;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators reference different elements, false otherwise.
+ */
+template <typename T>
+bool PackedList<T>::iterator::operator!=(const iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructor for a const iterator.
+ *
+ * @param list The list the iterator belongs to, used to step back from `cend()`.
+ * @param c The chunk holding the element, or nullptr for `cend()`.
+ * @param i The element's logical index within the chunk.
+ */
+template <typename T>
+PackedList<T>::const_iterator::const_iterator(const PackedList* list, const Chunk* c, std::size_t i) : owner(list), chunk(c), index(i) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return The current element by value.
+ */
+template <typename T>
+typename PackedList<T>::const_iterator::reference PackedList<T>::const_iterator::operator*() const {
+    return get(chunk, chunk->begin + index);
+}
+
+/**
+ * @brief Prefix increment operator for const iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename PackedList<T>::const_iterator& PackedList<T>::const_iterator::operator++() {
+    if (++index == chunk->count) {
+        chunk = chunk->next;
+        index = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Prefix decrement operator for const iterator; decrementing `cend()` yields the last element.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename T>
+typename PackedList<T>::const_iterator& PackedList<T>::const_iterator::operator--() {
+    if (!chunk || index == 0) {
+        chunk = chunk ? chunk->prev : owner->tail;
+        index = chunk->count - 1;
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename T>
+typename PackedList<T>::const_iterator PackedList<T>::const_iterator::operator++(int) {
+    const_iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+/**
+ * @brief Postfix decrement operator for const iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename T>
+typename PackedList<T>::const_iterator PackedList<T>::const_iterator::operator--(int) {
+    const_iterator tmp = *this;
+    --*this;
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if both iterators reference the same element, false otherwise.
+ */
+template <typename T>
+bool PackedList<T>::const_iterator::operator==(const const_iterator& other) const {
+    return chunk == other.chunk && index == other.index;
+}
+
+/**
+ * @brief Inequality comparison operator for const iterators.
+ *
+ * @param other The iterator to compare against.
+ * @return true if the iterators reference different elements, false otherwise.
+ */
+template <typename T>
+bool PackedList<T>::const_iterator::operator!=(const const_iterator& other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Constructs an empty packed list.
+ */
+template <typename T>
+PackedList<T>::PackedList() : head(nullptr), tail(nullptr), size(0) { }
+
+/**
+ * @brief Constructs a packed list holding the given values.
+ *
+ * @param init The values to store.
+ */
+template <typename T>
+PackedList<T>::PackedList(std::initializer_list<T> init) : PackedList() {
+    for (T value : init) {
+        push_back(value);
+    }
+}
+
+/**
+ * @brief Copy constructor, storing the other list's elements densely packed.
+ *
+ * @param other The list to copy from.
+ */
+template <typename T>
+PackedList<T>::PackedList(const PackedList& other) : PackedList() {
+    for (auto it = other.cbegin(); it != other.cend(); ++it) {
+        push_back(*it);
+    }
+}
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param other The list to copy from.
+ * @return A reference to this list.
+ */
+template <typename T>
+PackedList<T>& PackedList<T>::operator=(const PackedList& other) {
+    if (this != &other) {
+        PackedList copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys the list and frees all chunks.
+ */
+template <typename T>
+PackedList<T>::~PackedList() {
+    clear();
+}
+
+/**
+ * @brief Accessor to the front element of the list.
+ *
+ * @return A proxy reference to the front element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename PackedList<T>::reference PackedList<T>::front() {
+    if (!head) {
+        throw std::out_of_range("List is empty");
+    }
+    return reference(head, head->begin);
+}
+
+/**
+ * @brief Const accessor to the front element of the list.
+ *
+ * @return The front element by value.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename PackedList<T>::const_reference PackedList<T>::front() const {
+    if (!head) {
+        throw std::out_of_range("List is empty");
+    }
+    return get(head, head->begin);
+}
+
+/**
+ * @brief Accessor to the back element of the list.
+ *
+ * @return A proxy reference to the back element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename PackedList<T>::reference PackedList<T>::back() {
+    if (!tail) {
+        throw std::out_of_range("List is empty");
+    }
+    return reference(tail, tail->begin + tail->count - 1);
+}
+
+/**
+ * @brief Const accessor to the back element of the list.
+ *
+ * @return The back element by value.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename T>
+typename PackedList<T>::const_reference PackedList<T>::back() const {
+    if (!tail) {
+        throw std::out_of_range("List is empty");
+    }
+    return get(tail, tail->begin + tail->count - 1);
+}
+
+/**
+ * @brief Appends an element, starting a new chunk when the last one has no free lane at its end.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void PackedList<T>::push_back(T value) {
+    if (!tail || tail->begin + tail->count == chunk_capacity) {
+        new_chunk_after(tail, 0);
+    }
+    set(tail, tail->begin + tail->count, value);
+    ++tail->count;
+    ++size;
+}
+
+/**
+ * @brief Prepends an element, starting a new chunk that fills from its end when the first one has no free lane at its start.
+ *
+ * @param value The value to add.
+ */
+template <typename T>
+void PackedList<T>::push_front(T value) {
+    if (!head || head->begin == 0) {
+        new_chunk_after(nullptr, static_cast<std::uint16_t>(chunk_capacity));
+    }
+    --head->begin;
+    set(head, head->begin, value);
+    ++head->count;
+    ++size;
+}
+
+/**
+ * @brief Removes the last element from the list; does nothing if the list is empty.
+ */
+template <typename T>
+void PackedList<T>::pop_back() {
+    if (!tail) {
+        return;
+    }
+    if (--tail->count == 0) {
+        free_chunk(tail);
+    }
+    --size;
+}
+
+/**
+ * @brief Removes the first element from the list; does nothing if the list is empty.
+ */
+template <typename T>
+void PackedList<T>::pop_front() {
+    if (!head) {
+        return;
+    }
+    ++head->begin;
+    if (--head->count == 0) {
+        free_chunk(head);
+    }
+    --size;
+}
+
+/**
+ * @brief Inserts an element before the given position.
+ *
+ * Only lanes of the target chunk are shifted, towards whichever end has room. A full chunk is
+ * first split in half, so an insert never touches more than one chunk's worth of elements.
+ *
+ * @param pos The position to insert before.
+ * @param value The value to insert.
+ * @return An iterator to the inserted element.
+ */
+template <typename T>
+typename PackedList<T>::iterator PackedList<T>::insert(iterator pos, T value) {
+    if (!pos.chunk) {
+        push_back(value);
+        return iterator(this, tail, tail->count - 1);
+    }
+    Chunk* chunk = pos.chunk;
+    std::size_t index = pos.index;
+    if (chunk->count == chunk_capacity) {
+        std::size_t half = chunk_capacity / 2;
+        Chunk* upper = new_chunk_after(chunk, 0);
+        for (std::size_t i = half; i < chunk_capacity; ++i) {
+            set(upper, i - half, get(chunk, chunk->begin + i));
+        }
+        upper->count = static_cast<std::uint16_t>(chunk_capacity - half);
+        chunk->count = static_cast<std::uint16_t>(half);
+        if (index > half) {
+            chunk = upper;
+            index -= half;
+        }
+    }
+    if (chunk->begin + chunk->count < chunk_capacity) {
+        for (std::size_t i = chunk->count; i > index; --i) {
+            set(chunk, chunk->begin + i, get(chunk, chunk->begin + i - 1));
+        }
+    }
+    else {
+        --chunk->begin;
+        for (std::size_t i = 0; i < index; ++i) {
+            set(chunk, chunk->begin + i, get(chunk, chunk->begin + i + 1));
+        }
+    }
+    set(chunk, chunk->begin + index, value);
+    ++chunk->count;
+    ++size;
+    return iterator(this, chunk, index);
+}
+
+/**
+ * @brief Removes the element at the given position, shifting whichever side of its chunk is shorter.
+ *
+ * @param pos A valid element position.
+ * @return An iterator to the element that followed the removed one.
+ */
+template <typename T>
+typename PackedList<T>::iterator PackedList<T>::erase(iterator pos) {
+    Chunk* chunk = pos.chunk;
+    std::size_t index = pos.index;
+    if (index < chunk->count / 2) {
+        for (std::size_t i = index; i > 0; --i) {
+            set(chunk, chunk->begin + i, get(chunk, chunk->begin + i - 1));
+        }
+        ++chunk->begin;
+    }
+    else {
+        for (std::size_t i = index + 1; i < chunk->count; ++i) {
+            set(chunk, chunk->begin + i - 1, get(chunk, chunk->begin + i));
+        }
+    }
+    --chunk->count;
+    --size;
+    if (chunk->count == 0) {
+        Chunk* next = chunk->next;
+        free_chunk(chunk);
+        return iterator(this, next, 0);
+    }
+    if (index == chunk->count) {
+        return iterator(this, chunk->next, 0);
+    }
+    return iterator(this, chunk, index);
+}
+
+/**
+ * @brief Clears the list, freeing all chunks.
+ */
+template <typename T>
+void PackedList<T>::clear() {
+    while (head) {
+        Chunk* next = head->next;
+        delete head;
+        head = next;
+    }
+    tail = nullptr;
+    size = 0;
+}
+
+/**
+ * @brief Repacks the elements densely from the first chunk onwards and frees the chunks left over.
+ *
+ * Elements are moved forward in place: the write position never overtakes the read position,
+ * so no temporary storage is needed.
+ */
+template <typename T>
+void PackedList<T>::shrink_to_fit() {
+    if (!head) {
+        return;
+    }
+    Chunk* out = head;
+    std::size_t out_lane = 0;
+    for (Chunk* in = head; in; in = in->next) {
+        std::size_t begin = in->begin;
+        std::size_t count = in->count;
+        for (std::size_t i = 0; i < count; ++i) {
+            T value = get(in, begin + i);
+            if (out_lane == chunk_capacity) {
+                out->begin = 0;
+                out->count = static_cast<std::uint16_t>(chunk_capacity);
+                out = out->next;
+                out_lane = 0;
+            }
+            set(out, out_lane++, value);
+        }
+    }
+    out->begin = 0;
+    out->count = static_cast<std::uint16_t>(out_lane);
+    while (out->next) {
+        free_chunk(out->next);
+    }
+}
+
+/**
+ * @brief Swaps the contents of two lists in O(1).
+ *
+ * @param other The list to swap with.
+ */
+template <typename T>
+void PackedList<T>::swap(PackedList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(size, other.size);
+}
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return An iterator to the first element.
+ */
+template <typename T>
+typename PackedList<T>::iterator PackedList<T>::begin() {
+    return iterator(this, head, 0);
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return The end iterator.
+ */
+template <typename T>
+typename PackedList<T>::iterator PackedList<T>::end() {
+    return iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Returns a constant iterator to the first element.
+ *
+ * @return A constant iterator to the first element.
+ */
+template <typename T>
+typename PackedList<T>::const_iterator PackedList<T>::cbegin() const {
+    return const_iterator(this, head, 0);
+}
+
+/**
+ * @brief Returns a constant iterator past the last element.
+ *
+ * @return The constant end iterator.
+ */
+template <typename T>
+typename PackedList<T>::const_iterator PackedList<T>::cend() const {
+    return const_iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Counts the elements equal to a value, one 64-bit word of lanes at a time.
+ *
+ * @param value The value to count.
+ * @return The number of matching elements.
+ */
+template <typename T>
+typename PackedList<T>::size_type PackedList<T>::count(T value) const {
+    size_type total = 0;
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        for (std::size_t i = 0; i < chunk->count; i += lanes_per_word) {
+            std::size_t n = std::min(lanes_per_word, static_cast<std::size_t>(chunk->count) - i);
+            std::uint64_t block = extract(chunk, chunk->begin + i, n);
+            total += static_cast<size_type>(std::popcount(matches(block, value) & lanes(n)));
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Counts the set bits across all elements; for `PackedList<bool>` this is the number of `true` elements.
+ *
+ * @return The total number of one bits.
+ */
+template <typename T>
+typename PackedList<T>::size_type PackedList<T>::popcount() const {
+    size_type total = 0;
+    for (const Chunk* chunk = head; chunk; chunk = chunk->next) {
+        for (std::size_t i = 0; i < chunk->count; i += lanes_per_word) {
+            std::size_t n = std::min(lanes_per_word, static_cast<std::size_t>(chunk->count) - i);
+            total += static_cast<size_type>(std::popcount(extract(chunk, chunk->begin + i, n)));
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Equality comparison operator for packed lists.
+ *
+ * Both lists are walked in blocks of up to one word of lanes, realigned with `extract` so that
+ * lists whose chunks are laid out differently still compare a word at a time.
+ *
+ * @param other The list to compare against.
+ * @return true if both lists hold equal elements in the same order, false otherwise.
+ */
+template <typename T>
+bool PackedList<T>::operator==(const PackedList& other) const {
+    if (size != other.size) {
+        return false;
+    }
+    const Chunk* a = head;
+    const Chunk* b = other.head;
+    std::size_t ia = 0;
+    std::size_t ib = 0;
+    while (a && b) {
+        if (ia == a->count) {
+            a = a->next;
+            ia = 0;
+            continue;
+        }
+        if (ib == b->count) {
+            b = b->next;
+            ib = 0;
+            continue;
+        }
+        std::size_t n = std::min({lanes_per_word, static_cast<std::size_t>(a->count) - ia, static_cast<std::size_t>(b->count) - ib});
+        if (extract(a, a->begin + ia, n) != extract(b, b->begin + ib, n)) {
+            return false;
+        }
+        ia += n;
+        ib += n;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @return The size of the list.
+ */
+template <typename T>
+typename PackedList<T>::size_type PackedList<T>::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * @return `true` if the list is empty, `false` otherwise.
+ */
+template <typename T>
+bool PackedList<T>::empty() const {
+    return size == 0;
+}
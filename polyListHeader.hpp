@@ -0,0 +1,152 @@
+#ifndef POLY_LIST_H
+#define POLY_LIST_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "nodePoolHeader.hpp"
+
+#ifndef POLY_LIST_SIZE_CLASS
+#define POLY_LIST_SIZE_CLASS 16
+#endif
+
+template <typename Base>
+class PolyList {
+    static_assert(std::is_class_v<Base> && std::has_virtual_destructor_v<Base>,
+                  "PolyList requires a base class with a virtual destructor");
+
+private:
+    struct Node {
+        Node* next;
+        Node* prev;
+        Base* object;
+        void (*release)(Node*) noexcept;
+    };
+
+    template<typename Derived>
+    struct Layout {
+        static constexpr std::size_t align = std::max(alignof(Node), alignof(Derived));
+        static constexpr std::size_t offset = (sizeof(Node) + alignof(Derived) - 1) / alignof(Derived) * alignof(Derived);
+        static constexpr std::size_t size = (offset + sizeof(Derived) + POLY_LIST_SIZE_CLASS - 1) / POLY_LIST_SIZE_CLASS * POLY_LIST_SIZE_CLASS;
+    };
+
+    Node* head;
+    Node* tail;
+    std::size_t size;
+
+    template<std::size_t Size, std::size_t Align>
+    static void release(Node*) noexcept;
+
+    template<typename Derived, typename... Args>
+    static Node* make_node(Args&&...);
+
+    static void destroy_node(Node*) noexcept;
+    void link_before(Node*, Node*);
+    void unlink(Node*);
+
+public:
+    using value_type = Base;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Base&;
+    using const_reference = const Base&;
+
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Base;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Base*;
+        using reference = Base&;
+
+        iterator(const PolyList*, Node*);
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator& operator--();
+        iterator operator++(int);
+        iterator operator--(int);
+        bool operator==(const iterator&) const;
+        bool operator!=(const iterator&) const;
+        friend class PolyList<Base>;
+    private:
+        const PolyList* owner;
+        Node* node;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = const Base;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Base*;
+        using reference = const Base&;
+
+        const_iterator(const PolyList*, const Node*);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int);
+        const_iterator operator--(int);
+        bool operator==(const const_iterator&) const;
+        bool operator!=(const const_iterator&) const;
+    private:
+        const PolyList* owner;
+        const Node* node;
+    };
+
+    PolyList();
+    PolyList(const PolyList&) = delete;
+    PolyList& operator=(const PolyList&) = delete;
+    PolyList(PolyList&&) noexcept;
+    PolyList& operator=(PolyList&&) noexcept;
+    ~PolyList();
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    template<std::derived_from<Base> Derived = Base, typename... Args>
+    Derived& emplace_back(Args&&...);
+
+    template<std::derived_from<Base> Derived = Base, typename... Args>
+    Derived& emplace_front(Args&&...);
+
+    template<std::derived_from<Base> Derived = Base, typename... Args>
+    iterator emplace(iterator, Args&&...);
+
+    template<typename Derived>
+        requires std::derived_from<std::remove_cvref_t<Derived>, Base>
+    void push_back(Derived&&);
+
+    template<typename Derived>
+        requires std::derived_from<std::remove_cvref_t<Derived>, Base>
+    void push_front(Derived&&);
+
+    void pop_back();
+    void pop_front();
+    iterator erase(iterator);
+    void clear();
+    void swap(PolyList&) noexcept;
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "polyListImplementation.tpp"
+
+#endif
@@ -0,0 +1,618 @@
+#include "polyListHeader.hpp"
+
+/**
+ * @brief Returns a node's storage to the slab pool it was allocated from.
+ *
+ * Each node records the instantiation matching its size class, so nodes of different derived
+ * types can be released without knowing their type.
+ *
+ * @tparam Size The node's size class in bytes.
+ * @tparam Align The node's alignment.
+ * @param node The node to release; its object has already been destroyed.
+ */
+template <typename Base>
+template <std::size_t Size, std::size_t Align>
+void PolyList<Base>::release(Node* node) noexcept {
+    std::destroy_at(node);
+    NodePool<Size, Align>::instance().deallocate(node);
+}
+
+/**
+ * @brief Allocates a node with room for a `Derived` right after the links and constructs it there.
+ *
+ * The node comes from the shared slab pool for its size class, so the links and the object share
+ * one allocation and usually one cache line.
+ *
+ * @tparam Derived The type of the object to construct.
+ * @param args Arguments forwarded to the constructor of `Derived`.
+ * @return The new, unlinked node.
+ * @throw Whatever the constructor of `Derived` throws; the storage is released first.
+ */
+template <typename Base>
+template <typename Derived, typename... Args>
+typename PolyList<Base>::Node* PolyList<Base>::make_node(Args&&... args) {
+    using L = Layout<Derived>;
+    void* storage = NodePool<L::size, L::align>::instance().allocate();
+    Node* node = ::new (storage) Node{nullptr, nullptr, nullptr, &release<L::size, L::align>};
+    try {
+        node->object = ::new (static_cast<void*>(static_cast<unsigned char*>(storage) + L::offset))
+            Derived(std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node->release(node);
+        throw;
+    }
+    return node;
+}
+
+/**
+ * @brief Destroys a node's object through its virtual destructor and releases the node.
+ *
+ * @param node The unlinked node to destroy.
+ */
+template <typename Base>
+void PolyList<Base>::destroy_node(Node* node) noexcept {
+    node->object->~Base();
+    node->release(node);
+}
+
+/**
+ * @brief Links a node in front of another node.
+ *
+ * @param pos The node to link before, or nullptr to append.
+ * @param node The unlinked node.
+ */
+template <typename Base>
+void PolyList<Base>::link_before(Node* pos, Node* node) {
+    node->next = pos;
+    node->prev = pos ? pos->prev : tail;
+    if (node->prev) {
+        node->prev->next = node;
+    }
+    else {
+        head = node;
+    }
+    if (pos) {
+        pos->prev = node;
+    }
+    else {
+        tail = node;
+    }
+    ++size;
+}
+
+/**
+ * @brief Unlinks a node without destroying it.
+ *
+ * @param node The node to unlink.
+ */
+template <typename Base>
+void PolyList<Base>::unlink(Node* node) {
+    if (node->prev) {
+        node->prev->next = node->next;
+    }
+    else {
+        head = node->next;
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    }
+    else {
+        tail = node->prev;
+    }
+    --size;
+}
+
+/**
+ * @brief Constructor for an iterator.
+ *
+ * @param list The list the iterator belongs to, used to step back from `end()`.
+ * @param n The node to point to, or nullptr for `end()`.
+ */
+template <typename Base>
+PolyList<Base>::iterator::iterator(const PolyList* list, Node* n) : owner(list), node(n) { }
+
+/**
+ * @brief Dereference operator for iterator.
+ *
+ * @return A reference to the current element.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator::reference PolyList<Base>::iterator::operator*() const {
+    return *node->object;
+}
+
+/**
+ * @brief Arrow operator for iterator.
+ *
+ * @return A pointer to the current element.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator::pointer PolyList<Base>::iterator::operator->() const {
+    return node->object;
+}
+
+/**
+ * @brief Pre-increment operator for iterator.
+ *
+ * @return A reference to the incremented iterator.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator& PolyList<Base>::iterator::operator++() {
+    node = node->next;
+    return *this;
+}
+
+/**
+ * @brief Pre-decrement operator for iterator.
+ *
+ * Decrementing `end()` moves to the last element.
+ *
+ * @return A reference to the decremented iterator.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator& PolyList<Base>::iterator::operator--() {
+    node = node ? node->prev : owner->tail;
+    return *this;
+}
+
+/**
+ * @brief Post-increment operator for iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator PolyList<Base>::iterator::operator++(int) {
+    iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+/**
+ * @brief Post-decrement operator for iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator PolyList<Base>::iterator::operator--(int) {
+    iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+/**
+ * @brief Equality operator for iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if both iterators point to the same node.
+ */
+template <typename Base>
+bool PolyList<Base>::iterator::operator==(const iterator& other) const {
+    return node == other.node;
+}
+
+/**
+ * @brief Inequality operator for iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if the iterators point to different nodes.
+ */
+template <typename Base>
+bool PolyList<Base>::iterator::operator!=(const iterator& other) const {
+    return node != other.node;
+}
+
+/**
+ * @brief Constructor for a const iterator.
+ *
+ * @param list The list the iterator belongs to, used to step back from `end()`.
+ * @param n The node to point to, or nullptr for `end()`.
+ */
+template <typename Base>
+PolyList<Base>::const_iterator::const_iterator(const PolyList* list, const Node* n) : owner(list), node(n) { }
+
+/**
+ * @brief Dereference operator for const iterator.
+ *
+ * @return A const reference to the current element.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator::reference PolyList<Base>::const_iterator::operator*() const {
+    return *node->object;
+}
+
+/**
+ * @brief Arrow operator for const iterator.
+ *
+ * @return A const pointer to the current element.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator::pointer PolyList<Base>::const_iterator::operator->() const {
+    return node->object;
+}
+
+/**
+ * @brief Pre-increment operator for const iterator.
+ *
+ * @return A reference to the incremented iterator.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator& PolyList<Base>::const_iterator::operator++() {
+    node = node->next;
+    return *this;
+}
+
+/**
+ * @brief Pre-decrement operator for const iterator.
+ *
+ * Decrementing `end()` moves to the last element.
+ *
+ * @return A reference to the decremented iterator.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator& PolyList<Base>::const_iterator::operator--() {
+    node = node ? node->prev : owner->tail;
+    return *this;
+}
+
+/**
+ * @brief Post-increment operator for const iterator.
+ *
+ * @return A copy of the iterator before it was incremented.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator PolyList<Base>::const_iterator::operator++(int) {
+    const_iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+/**
+ * @brief Post-decrement operator for const iterator.
+ *
+ * @return A copy of the iterator before it was decremented.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator PolyList<Base>::const_iterator::operator--(int) {
+    const_iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+/**
+ * @brief Equality operator for const iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if both iterators point to the same node.
+ */
+template <typename Base>
+bool PolyList<Base>::const_iterator::operator==(const const_iterator& other) const {
+    return node == other.node;
+}
+
+/**
+ * @brief Inequality operator for const iterator.
+ *
+ * @param other The iterator to compare with.
+ * @return True if the iterators point to different nodes.
+ */
+template <typename Base>
+bool PolyList<Base>::const_iterator::operator!=(const const_iterator& other) const {
+    return node != other.node;
+}
+
+/**
+ * @brief Constructs an empty list.
+ */
+template <typename Base>
+PolyList<Base>::PolyList() : head(nullptr), tail(nullptr), size(0) { }
+
+/**
+ * @brief Move constructor, taking over another list's nodes in O(1).
+ *
+ * @param other The list to move from; left empty.
+ */
+template <typename Base>
+PolyList<Base>::PolyList(PolyList&& other) noexcept : PolyList() {
+    swap(other);
+}
+
+/**
+ * @brief Move assignment operator, destroying the current elements and taking over another list's nodes.
+ *
+ * @param other The list to move from; left empty.
+ * @return A reference to this list.
+ */
+template <typename Base>
+PolyList<Base>& PolyList<Base>::operator=(PolyList&& other) noexcept {
+    if (this != &other) {
+        clear();
+        swap(other);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroys every element through its virtual destructor and frees the nodes.
+ */
+template <typename Base>
+PolyList<Base>::~PolyList() {
+    clear();
+}
+
+/**
+ * @brief Accesses the first element.
+ *
+ * @return A reference to the first element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename Base>
+typename PolyList<Base>::reference PolyList<Base>::front() {
+    if (!head) {
+        throw std::out_of_range("List is empty");
+    }
+    return *head->object;
+}
+
+/**
+ * @brief Reads the first element.
+ *
+ * @return A const reference to the first element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename Base>
+typename PolyList<Base>::const_reference PolyList<Base>::front() const {
+    if (!head) {
+        throw std::out_of_range("List is empty");
+    }
+    return *head->object;
+}
+
+/**
+ * @brief Accesses the last element.
+ *
+ * @return A reference to the last element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename Base>
+typename PolyList<Base>::reference PolyList<Base>::back() {
+    if (!tail) {
+        throw std::out_of_range("List is empty");
+    }
+    return *tail->object;
+}
+
+/**
+ * @brief Reads the last element.
+ *
+ * @return A const reference to the last element.
+ * @throw std::out_of_range if the list is empty.
+ */
+template <typename Base>
+typename PolyList<Base>::const_reference PolyList<Base>::back() const {
+    if (!tail) {
+        throw std::out_of_range("List is empty");
+    }
+    return *tail->object;
+}
+
+/**
+ * @brief Constructs a `Derived` inside a new node at the back of the list.
+ *
+ * @tparam Derived The type to construct; defaults to `Base`.
+ * @param args Arguments forwarded to the constructor of `Derived`.
+ * @return A reference to the new element.
+ */
+template <typename Base>
+template <std::derived_from<Base> Derived, typename... Args>
+Derived& PolyList<Base>::emplace_back(Args&&... args) {
+    Node* node = make_node<Derived>(std::forward<Args>(args)...);
+    link_before(nullptr, node);
+    return static_cast<Derived&>(*node->object);
+}
+
+/**
+ * @brief Constructs a `Derived` inside a new node at the front of the list.
+ *
+ * @tparam Derived The type to construct; defaults to `Base`.
+ * @param args Arguments forwarded to the constructor of `Derived`.
+ * @return A reference to the new element.
+ */
+template <typename Base>
+template <std::derived_from<Base> Derived, typename... Args>
+Derived& PolyList<Base>::emplace_front(Args&&... args) {
+    Node* node = make_node<Derived>(std::forward<Args>(args)...);
+    link_before(head, node);
+    return static_cast<Derived&>(*node->object);
+}
+
+/**
+ * @brief Constructs a `Derived` inside a new node before a position.
+ *
+ * @tparam Derived The type to construct; defaults to `Base`.
+ * @param pos The position to insert before; `end()` appends.
+ * @param args Arguments forwarded to the constructor of `Derived`.
+ * @return An iterator to the new element.
+ */
+template <typename Base>
+template <std::derived_from<Base> Derived, typename... Args>
+typename PolyList<Base>::iterator PolyList<Base>::emplace(iterator pos, Args&&... args) {
+    Node* node = make_node<Derived>(std::forward<Args>(args)...);
+    link_before(pos.node, node);
+    return iterator(this, node);
+}
+
+/**
+ * @brief Appends a copy of, or moves, an object of a type derived from `Base`.
+ *
+ * The node is sized for the argument's static type, so pass the most derived type.
+ *
+ * @param value The object to copy or move into the list.
+ */
+template <typename Base>
+template <typename Derived>
+    requires std::derived_from<std::remove_cvref_t<Derived>, Base>
+void PolyList<Base>::push_back(Derived&& value) {
+    emplace_back<std::remove_cvref_t<Derived>>(std::forward<Derived>(value));
+}
+
+/**
+ * @brief Prepends a copy of, or moves, an object of a type derived from `Base`.
+ *
+ * The node is sized for the argument's static type, so pass the most derived type.
+ *
+ * @param value The object to copy or move into the list.
+ */
+template <typename Base>
+template <typename Derived>
+    requires std::derived_from<std::remove_cvref_t<Derived>, Base>
+void PolyList<Base>::push_front(Derived&& value) {
+    emplace_front<std::remove_cvref_t<Derived>>(std::forward<Derived>(value));
+}
+
+/**
+ * @brief Removes the last element; does nothing if the list is empty.
+ */
+template <typename Base>
+void PolyList<Base>::pop_back() {
+    if (!tail) {
+        return;
+    }
+    Node* node = tail;
+    unlink(node);
+    destroy_node(node);
+}
+
+/**
+ * @brief Removes the first element; does nothing if the list is empty.
+ */
+template <typename Base>
+void PolyList<Base>::pop_front() {
+    if (!head) {
+        return;
+    }
+    Node* node = head;
+    unlink(node);
+    destroy_node(node);
+}
+
+/**
+ * @brief Removes the element at a position.
+ *
+ * @param pos The element to remove; must not be `end()`.
+ * @return An iterator to the element that followed the removed one.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator PolyList<Base>::erase(iterator pos) {
+    Node* node = pos.node;
+    Node* next = node->next;
+    unlink(node);
+    destroy_node(node);
+    return iterator(this, next);
+}
+
+/**
+ * @brief Destroys every element and frees the nodes.
+ */
+template <typename Base>
+void PolyList<Base>::clear() {
+    while (head) {
+        Node* next = head->next;
+        destroy_node(head);
+        head = next;
+    }
+    tail = nullptr;
+    size = 0;
+}
+
+/**
+ * @brief Swaps the contents of two lists in O(1).
+ *
+ * @param other The list to swap with.
+ */
+template <typename Base>
+void PolyList<Base>::swap(PolyList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(size, other.size);
+}
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return An iterator to the first element, or `end()` if the list is empty.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator PolyList<Base>::begin() {
+    return iterator(this, head);
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return The end iterator.
+ */
+template <typename Base>
+typename PolyList<Base>::iterator PolyList<Base>::end() {
+    return iterator(this, nullptr);
+}
+
+/**
+ * @brief Returns a const iterator to the first element.
+ *
+ * @return A const iterator to the first element, or `end()` if the list is empty.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator PolyList<Base>::begin() const {
+    return const_iterator(this, head);
+}
+
+/**
+ * @brief Returns a const iterator past the last element.
+ *
+ * @return The const end iterator.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator PolyList<Base>::end() const {
+    return const_iterator(this, nullptr);
+}
+
+/**
+ * @brief Returns a const iterator to the first element.
+ *
+ * @return A const iterator to the first element, or `cend()` if the list is empty.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator PolyList<Base>::cbegin() const {
+    return const_iterator(this, head);
+}
+
+/**
+ * @brief Returns a const iterator past the last element.
+ *
+ * @return The const end iterator.
+ */
+template <typename Base>
+typename PolyList<Base>::const_iterator PolyList<Base>::cend() const {
+    return const_iterator(this, nullptr);
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @return The number of elements.
+ */
+template <typename Base>
+typename PolyList<Base>::size_type PolyList<Base>::getSize() const {
+    return size;
+}
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * @return True if the list holds no elements.
+ */
+template <typename Base>
+bool PolyList<Base>::empty() const {
+    return size == 0;
+}
@@ -0,0 +1,96 @@
+#ifndef SPLIT_ORDERED_HASH_MAP_H
+#define SPLIT_ORDERED_HASH_MAP_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <optional>
+#include <utility>
+#include "epochReclaimerHeader.hpp"
+#include "nodePoolHeader.hpp"
+
+#ifndef SPLIT_ORDERED_MAX_LOAD
+#define SPLIT_ORDERED_MAX_LOAD 2
+#endif
+
+#ifndef SPLIT_ORDERED_INITIAL_BUCKETS
+#define SPLIT_ORDERED_INITIAL_BUCKETS 16
+#endif
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class SplitOrderedHashMap {
+    static_assert(std::has_single_bit(static_cast<unsigned>(SPLIT_ORDERED_INITIAL_BUCKETS)),
+                  "SPLIT_ORDERED_INITIAL_BUCKETS must be a power of two");
+
+private:
+    using link = std::atomic<std::uintptr_t>;
+    static constexpr unsigned segment_count = 64;
+
+    struct Entry {
+        link next;
+        std::uint64_t order;
+        explicit Entry(std::uint64_t);
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+    };
+
+    struct Node : Entry {
+        K key;
+        V value;
+        template<typename Key, typename Value>
+        Node(std::uint64_t, Key&&, Value&&);
+        static void* operator new(std::size_t);
+        static void operator delete(void*) noexcept;
+        static void reclaim(void*);
+    };
+
+    mutable std::atomic<std::atomic<Entry*>*> segments[segment_count];
+    std::atomic<std::size_t> buckets;
+    std::atomic<std::size_t> count;
+    [[no_unique_address]] Hash hasher;
+    [[no_unique_address]] KeyEqual equal;
+
+    static Entry* pointer(std::uintptr_t);
+    static std::uintptr_t word(const Entry*);
+    static bool marked(std::uintptr_t);
+    static std::uint64_t element_order(std::uint64_t);
+    static std::uint64_t sentinel_order(std::size_t);
+
+    std::atomic<Entry*>& bucket_slot(std::size_t) const;
+    link* bucket_head(std::size_t) const;
+    link* bucket_for(std::uint64_t) const;
+    bool find(link*, std::uint64_t, const K*, link*&, Entry*&) const;
+
+    template<typename Key, typename Value>
+    bool emplace(Key&&, Value&&);
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    SplitOrderedHashMap();
+    SplitOrderedHashMap(const SplitOrderedHashMap&) = delete;
+    SplitOrderedHashMap& operator=(const SplitOrderedHashMap&) = delete;
+    ~SplitOrderedHashMap();
+
+    bool insert(const K&, const V&);
+    bool insert(K&&, V&&);
+    bool erase(const K&);
+    std::optional<V> find(const K&) const;
+    bool contains(const K&) const;
+
+    template<typename F>
+    void for_each(F&&) const;
+
+    size_type bucket_count() const;
+    size_type getSize() const;
+    bool empty() const;
+};
+
+#include "splitOrderedHashMapImplementation.tpp"
+
+#endif
@@ -0,0 +1,492 @@
+#include "splitOrderedHashMapHeader.hpp"
+
+/**
+ * @brief Constructs an unlinked list entry.
+ *
+ * @param order The entry's split-order key.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+SplitOrderedHashMap<K, V, Hash, KeyEqual>::Entry::Entry(std::uint64_t order) : next(0), order(order) { }
+
+/**
+ * @brief Allocates a bucket sentinel from the shared slab pool.
+ *
+ * @param bytes Unused; sentinels have a fixed size.
+ * @return Storage for one sentinel.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void* SplitOrderedHashMap<K, V, Hash, KeyEqual>::Entry::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Entry), alignof(Entry)>::instance().allocate();
+}
+
+/**
+ * @brief Returns a bucket sentinel's storage to the shared slab pool.
+ *
+ * @param ptr The sentinel storage.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void SplitOrderedHashMap<K, V, Hash, KeyEqual>::Entry::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Entry), alignof(Entry)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Constructs an unlinked element node.
+ *
+ * @param order The node's split-order key.
+ * @param key The key.
+ * @param value The value.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename Key, typename Value>
+SplitOrderedHashMap<K, V, Hash, KeyEqual>::Node::Node(std::uint64_t order, Key&& key, Value&& value)
+    : Entry(order), key(std::forward<Key>(key)), value(std::forward<Value>(value)) { }
+
+/**
+ * @brief Allocates an element node from the shared slab pool.
+ *
+ * @param bytes Unused; nodes have a fixed size.
+ * @return Storage for one node.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void* SplitOrderedHashMap<K, V, Hash, KeyEqual>::Node::operator new(std::size_t bytes) {
+    (void)bytes;
+    return NodePool<sizeof(Node), alignof(Node)>::instance().allocate();
+}
+
+/**
+ * @brief Returns an element node's storage to the shared slab pool.
+ *
+ * @param ptr The node storage.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void SplitOrderedHashMap<K, V, Hash, KeyEqual>::Node::operator delete(void* ptr) noexcept {
+    NodePool<sizeof(Node), alignof(Node)>::instance().deallocate(ptr);
+}
+
+/**
+ * @brief Frees an element node retired through `EpochReclaimer`.
+ *
+ * @param node The node to free.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void SplitOrderedHashMap<K, V, Hash, KeyEqual>::Node::reclaim(void* node) {
+    delete static_cast<Node*>(node);
+}
+
+/**
+ * @brief Strips the deletion mark from a link.
+ *
+ * @param value The link's contents.
+ * @return The entry it points to, or nullptr.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename SplitOrderedHashMap<K, V, Hash, KeyEqual>::Entry* SplitOrderedHashMap<K, V, Hash, KeyEqual>::pointer(std::uintptr_t value) {
+    return reinterpret_cast<Entry*>(value & ~std::uintptr_t(1));
+}
+
+/**
+ * @brief Converts an entry pointer to unmarked link contents.
+ *
+ * @param entry The entry, or nullptr.
+ * @return The link contents.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::uintptr_t SplitOrderedHashMap<K, V, Hash, KeyEqual>::word(const Entry* entry) {
+    return reinterpret_cast<std::uintptr_t>(entry);
+}
+
+/**
+ * @brief Checks whether a link carries the deletion mark of the node that owns it.
+ *
+ * @param value The link's contents.
+ * @return True if the owning node is logically deleted.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool SplitOrderedHashMap<K, V, Hash, KeyEqual>::marked(std::uintptr_t value) {
+    return value & 1;
+}
+
+/**
+ * @brief Computes the split-order key of an element: its hash with the top bit set, bit-reversed.
+ *
+ * The reversal makes every bucket a contiguous run of the list for any power-of-two bucket count,
+ * and the set top bit (the low bit after reversal) orders an element after its bucket's sentinel.
+ *
+ * @param hash The element's hash.
+ * @return The split-order key, always odd.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::uint64_t SplitOrderedHashMap<K, V, Hash, KeyEqual>::element_order(std::uint64_t hash) {
+    return sentinel_order(hash | (std::uint64_t(1) << 63));
+}
+
+/**
+ * @brief Computes the split-order key of a bucket sentinel: its bucket index, bit-reversed.
+ *
+ * @param index The bucket index.
+ * @return The split-order key, even for every index below 2^63.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::uint64_t SplitOrderedHashMap<K, V, Hash, KeyEqual>::sentinel_order(std::size_t index) {
+    std::uint64_t bits = index;
+    bits = (bits >> 1 & 0x5555555555555555ULL) | (bits & 0x5555555555555555ULL) << 1;
+    bits = (bits >> 2 & 0x3333333333333333ULL) | (bits & 0x3333333333333333ULL) << 2;
+    bits = (bits >> 4 & 0x0F0F0F0F0F0F0F0FULL) | (bits & 0x0F0F0F0F0F0F0F0FULL) << 4;
+    bits = (bits >> 8 & 0x00FF00FF00FF00FFULL) | (bits & 0x00FF00FF00FF00FFULL) << 8;
+    bits = (bits >> 16 & 0x0000FFFF0000FFFFULL) | (bits & 0x0000FFFF0000FFFFULL) << 16;
+    return bits >> 32 | bits << 32;
+}
+
+/**
+ * @brief Returns the shortcut slot of a bucket, allocating its segment on first use.
+ *
+ * Bucket 0 lives in segment 0, and buckets [2^(s-1), 2^s) in segment s, so the bucket array grows
+ * by doubling without ever moving a slot. Threads racing to allocate a segment agree through a
+ * compare-and-swap and the loser frees its copy.
+ *
+ * @param index The bucket index.
+ * @return The slot, holding the bucket's sentinel or nullptr if the bucket is not initialized.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::atomic<typename SplitOrderedHashMap<K, V, Hash, KeyEqual>::Entry*>& SplitOrderedHashMap<K, V, Hash, KeyEqual>::bucket_slot(std::size_t index) const {
+    unsigned segment = std::bit_width(index);
+    std::size_t length = segment ? std::size_t(1) << (segment - 1) : 1;
+    std::atomic<Entry*>* slots = segments[segment].load(std::memory_order_acquire);
+    if (!slots) {
+        std::atomic<Entry*>* fresh = new std::atomic<Entry*>[length]();
+        if (segments[segment].compare_exchange_strong(slots, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            slots = fresh;
+        }
+        else {
+            delete[] fresh;
+        }
+    }
+    return slots[segment ? index - length : 0];
+}
+
+/**
+ * @brief Returns the link after a bucket's sentinel, initializing the bucket on first use.
+ *
+ * A new bucket's sentinel is inserted into the list starting from its parent bucket (the index
+ * with its top bit cleared), which is initialized first if needed. Only one sentinel per bucket
+ * ever enters the list; a thread that finds one already linked adopts it.
+ *
+ * @param index The bucket index.
+ * @return The sentinel's next link, the start of every search in that bucket.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename SplitOrderedHashMap<K, V, Hash, KeyEqual>::link* SplitOrderedHashMap<K, V, Hash, KeyEqual>::bucket_head(std::size_t index) const {
+    std::atomic<Entry*>& slot = bucket_slot(index);
+    Entry* sentinel = slot.load(std::memory_order_acquire);
+    if (!sentinel) {
+        link* start = bucket_head(index & ~(std::size_t(1) << (std::bit_width(index) - 1)));
+        std::uint64_t order = sentinel_order(index);
+        sentinel = new Entry(order);
+        for (;;) {
+            link* pred;
+            Entry* curr;
+            if (find(start, order, nullptr, pred, curr)) {
+                delete sentinel;
+                sentinel = curr;
+                break;
+            }
+            sentinel->next.store(word(curr), std::memory_order_relaxed);
+            std::uintptr_t expected = word(curr);
+            if (pred->compare_exchange_strong(expected, word(sentinel), std::memory_order_release, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        slot.store(sentinel, std::memory_order_release);
+    }
+    return &sentinel->next;
+}
+
+/**
+ * @brief Returns the start of the bucket a hash belongs to under the current bucket count.
+ *
+ * @param hash The hash.
+ * @return The bucket sentinel's next link.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename SplitOrderedHashMap<K, V, Hash, KeyEqual>::link* SplitOrderedHashMap<K, V, Hash, KeyEqual>::bucket_for(std::uint64_t hash) const {
+    return bucket_head(hash & (buckets.load(std::memory_order_acquire) - 1));
+}
+
+/**
+ * @brief Searches the list from a bucket sentinel, unlinking deleted nodes on the way.
+ *
+ * A node whose link carries the deletion mark is cut out by swinging its predecessor's link past
+ * it; the thread whose compare-and-swap succeeds retires the node. If the predecessor changed or
+ * was itself deleted, the search restarts from the sentinel.
+ *
+ * @param start The sentinel's next link.
+ * @param order The split-order key to look for.
+ * @param key The element key to match among equal split-order keys, or nullptr to look for a sentinel.
+ * @param pred Receives the link that points at `curr`.
+ * @param curr Receives the matching entry, or the first entry ordered after it.
+ * @return True if a matching entry was found.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool SplitOrderedHashMap<K, V, Hash, KeyEqual>::find(link* start, std::uint64_t order, const K* key, link*& pred, Entry*& curr) const {
+retry:
+    pred = start;
+    std::uintptr_t current = pred->load(std::memory_order_acquire);
+    for (;;) {
+        curr = pointer(current);
+        if (!curr) {
+            return false;
+        }
+        std::uintptr_t next = curr->next.load(std::memory_order_acquire);
+        if (marked(next)) {
+            std::uintptr_t expected = word(curr);
+            if (!pred->compare_exchange_strong(expected, next & ~std::uintptr_t(1), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                goto retry;
+            }
+            EpochReclaimer::retire(static_cast<Node*>(curr), &Node::reclaim);
+            current = next & ~std::uintptr_t(1);
+            continue;
+        }
+        if (curr->order > order) {
+            return false;
+        }
+        if (curr->order == order && (!key || equal(static_cast<Node*>(curr)->key, *key))) {
+            return true;
+        }
+        pred = &curr->next;
+        current = next;
+    }
+}
+
+/**
+ * @brief Constructs an empty map with `SPLIT_ORDERED_INITIAL_BUCKETS` buckets.
+ *
+ * Only bucket 0 is initialized; the others get their sentinels on first use.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+SplitOrderedHashMap<K, V, Hash, KeyEqual>::SplitOrderedHashMap() : buckets(SPLIT_ORDERED_INITIAL_BUCKETS), count(0) {
+    for (auto& segment : segments) {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
+    bucket_slot(0).store(new Entry(0), std::memory_order_release);
+}
+
+/**
+ * @brief Destroys every node and sentinel in the list and frees the bucket array.
+ *
+ * Must not run concurrently with any other operation on the map. Nodes already retired are
+ * freed by `EpochReclaimer`.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+SplitOrderedHashMap<K, V, Hash, KeyEqual>::~SplitOrderedHashMap() {
+    Entry* entry = bucket_slot(0).load(std::memory_order_acquire);
+    while (entry) {
+        Entry* next = pointer(entry->next.load(std::memory_order_relaxed));
+        if (entry->order & 1) {
+            delete static_cast<Node*>(entry);
+        }
+        else {
+            delete entry;
+        }
+        entry = next;
+    }
+    for (auto& segment : segments) {
+        delete[] segment.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Links a new node for a key that is not present yet, then grows the bucket count if the
+ * load factor exceeds `SPLIT_ORDERED_MAX_LOAD`.
+ *
+ * Growing only doubles the bucket count; no node moves. New buckets are split off their parents
+ * lazily, the first time an operation hashes into them.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the key was inserted, false if it was already present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename Key, typename Value>
+bool SplitOrderedHashMap<K, V, Hash, KeyEqual>::emplace(Key&& key, Value&& value) {
+    EpochReclaimer::Guard guard;
+    std::uint64_t hash = hasher(key);
+    std::uint64_t order = element_order(hash);
+    link* start = bucket_for(hash);
+    Node* node = nullptr;
+    for (;;) {
+        link* pred;
+        Entry* curr;
+        if (find(start, order, node ? &node->key : &key, pred, curr)) {
+            delete node;
+            return false;
+        }
+        if (!node) {
+            node = new Node(order, std::forward<Key>(key), std::forward<Value>(value));
+        }
+        node->next.store(word(curr), std::memory_order_relaxed);
+        std::uintptr_t expected = word(curr);
+        if (pred->compare_exchange_strong(expected, word(node), std::memory_order_release, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    std::size_t size = count.fetch_add(1, std::memory_order_relaxed) + 1;
+    std::size_t current = buckets.load(std::memory_order_relaxed);
+    if (size > current * SPLIT_ORDERED_MAX_LOAD && current < (std::size_t(1) << (segment_count - 2))) {
+        buckets.compare_exchange_strong(current, current * 2, std::memory_order_release, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+/**
+ * @brief Inserts a copy of a key and value if the key is not present.
+ *
+ * Lock-free; safe to call concurrently with every other operation.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the pair was inserted, false if the key was already present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool SplitOrderedHashMap<K, V, Hash, KeyEqual>::insert(const K& key, const V& value) {
+    return emplace(key, value);
+}
+
+/**
+ * @brief Moves a key and value into the map if the key is not present.
+ *
+ * Lock-free; safe to call concurrently with every other operation.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return True if the pair was inserted, false if the key was already present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool SplitOrderedHashMap<K, V, Hash, KeyEqual>::insert(K&& key, V&& value) {
+    return emplace(std::move(key), std::move(value));
+}
+
+/**
+ * @brief Removes a key.
+ *
+ * Setting the mark bit in the node's link is the linearization point, and the thread that sets
+ * it owns the removal. It then tries to unlink the node once, and on failure leaves that to a
+ * search.
+ *
+ * Lock-free; safe to call concurrently with every other operation.
+ *
+ * @param key The key to remove.
+ * @return True if this call removed the key, false if it was not present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool SplitOrderedHashMap<K, V, Hash, KeyEqual>::erase(const K& key) {
+    EpochReclaimer::Guard guard;
+    std::uint64_t hash = hasher(key);
+    std::uint64_t order = element_order(hash);
+    link* start = bucket_for(hash);
+    link* pred;
+    Entry* curr;
+    if (!find(start, order, &key, pred, curr)) {
+        return false;
+    }
+    std::uintptr_t next = curr->next.fetch_or(1, std::memory_order_acq_rel);
+    if (marked(next)) {
+        return false;
+    }
+    count.fetch_sub(1, std::memory_order_relaxed);
+    std::uintptr_t expected = word(curr);
+    if (pred->compare_exchange_strong(expected, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        EpochReclaimer::retire(static_cast<Node*>(curr), &Node::reclaim);
+    }
+    else {
+        find(start, order, &key, pred, curr);
+    }
+    return true;
+}
+
+/**
+ * @brief Looks up a key.
+ *
+ * @param key The key to look for.
+ * @return A copy of the value, or an empty optional if the key is not present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::optional<V> SplitOrderedHashMap<K, V, Hash, KeyEqual>::find(const K& key) const {
+    EpochReclaimer::Guard guard;
+    std::uint64_t hash = hasher(key);
+    link* pred;
+    Entry* curr;
+    if (find(bucket_for(hash), element_order(hash), &key, pred, curr)) {
+        return static_cast<Node*>(curr)->value;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Checks whether a key is present.
+ *
+ * @param key The key to look for.
+ * @return True if the key is present.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool SplitOrderedHashMap<K, V, Hash, KeyEqual>::contains(const K& key) const {
+    EpochReclaimer::Guard guard;
+    std::uint64_t hash = hasher(key);
+    link* pred;
+    Entry* curr;
+    return find(bucket_for(hash), element_order(hash), &key, pred, curr);
+}
+
+/**
+ * @brief Calls a function on every pair, in split order (no meaningful key order).
+ *
+ * The walk is weakly consistent: it sees every pair present for its whole duration, may or may
+ * not see pairs inserted or erased while it runs, and never sees a key twice.
+ *
+ * @param fn Callable as `fn(const K&, const V&)`.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename F>
+void SplitOrderedHashMap<K, V, Hash, KeyEqual>::for_each(F&& fn) const {
+    EpochReclaimer::Guard guard;
+    for (const Entry* entry = bucket_slot(0).load(std::memory_order_acquire); entry;) {
+        std::uintptr_t next = entry->next.load(std::memory_order_acquire);
+        if ((entry->order & 1) && !marked(next)) {
+            const Node* node = static_cast<const Node*>(entry);
+            fn(node->key, node->value);
+        }
+        entry = pointer(next);
+    }
+}
+
+/**
+ * @brief Returns the current number of buckets, always a power of two.
+ *
+ * @return The bucket count.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename SplitOrderedHashMap<K, V, Hash, KeyEqual>::size_type SplitOrderedHashMap<K, V, Hash, KeyEqual>::bucket_count() const {
+    return buckets.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of pairs in the map.
+ *
+ * With concurrent inserts and erases the result is only a snapshot.
+ *
+ * @return The approximate number of pairs.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename SplitOrderedHashMap<K, V, Hash, KeyEqual>::size_type SplitOrderedHashMap<K, V, Hash, KeyEqual>::getSize() const {
+    return count.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Checks whether the map is empty.
+ *
+ * @return True if the map held no pairs when checked.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool SplitOrderedHashMap<K, V, Hash, KeyEqual>::empty() const {
+    return getSize() == 0;
+}
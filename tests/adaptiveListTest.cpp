@@ -0,0 +1,273 @@
+#include "adaptiveListHeader.hpp"
+#include "stressCheck.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Drives an AdaptiveList through alternating phases of front edits and scans, so it converts to
+// linked nodes and back several times, and checks every result against a std::vector model.
+// Iterators returned by insert and erase are checked against the model even when the call itself
+// converted the list. A type whose copy throws checks that a failed conversion leaves the list
+// contiguous and unchanged, and reads through a const list must not count towards a switch.
+
+namespace {
+
+struct Random {
+    std::uint64_t state;
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+void check_equal(const AdaptiveList<std::string>& list, const std::vector<std::string>& model) {
+    STRESS_CHECK(list.getSize() == model.size());
+    STRESS_CHECK(list.empty() == model.empty());
+    std::size_t index = 0;
+    for (AdaptiveList<std::string>::const_iterator it = list.cbegin(); it != list.cend(); ++it) {
+        STRESS_CHECK(index < model.size() && *it == model[index]);
+        ++index;
+    }
+    STRESS_CHECK(index == model.size());
+    AdaptiveList<std::string>::const_iterator it = list.cend();
+    while (index > 0) {
+        --it;
+        --index;
+        STRESS_CHECK(*it == model[index]);
+    }
+    STRESS_CHECK(it == list.cbegin());
+    if (!model.empty()) {
+        STRESS_CHECK(list.front() == model.front() && list.back() == model.back());
+        STRESS_CHECK(list[model.size() / 2] == model[model.size() / 2]);
+    }
+}
+
+struct Switches {
+    std::size_t to_linked = 0;
+    std::size_t to_contiguous = 0;
+    std::size_t inside_edit = 0;
+};
+
+void note_switch(bool was_contiguous, const AdaptiveList<std::string>& list, Switches& switches) {
+    if (was_contiguous && !list.is_contiguous()) {
+        ++switches.to_linked;
+    }
+    else if (!was_contiguous && list.is_contiguous()) {
+        ++switches.to_contiguous;
+    }
+}
+
+// Front and near-front edits, which favour linked storage.
+void edit_phase(AdaptiveList<std::string>& list, std::vector<std::string>& model, Random& random,
+                std::uint64_t operations, std::uint64_t& serial, Switches& switches) {
+    for (std::uint64_t n = 0; n < operations; ++n) {
+        std::uint64_t r = random.next();
+        bool was_contiguous = list.is_contiguous();
+        std::size_t offset = model.empty() ? 0 : (r >> 8) % std::min<std::size_t>(model.size(), 4);
+        switch (r % 6) {
+        case 0:
+        case 1: {
+            std::string value = std::to_string(serial++);
+            AdaptiveList<std::string>::iterator pos = list.begin();
+            std::advance(pos, offset);
+            AdaptiveList<std::string>::iterator result = list.insert(pos, value);
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(offset), value);
+            STRESS_CHECK(*result == model[offset]);
+            if (offset > 0) {
+                STRESS_CHECK(*std::prev(result) == model[offset - 1]);
+            }
+            break;
+        }
+        case 2: {
+            if (model.size() < 2) {
+                break;
+            }
+            AdaptiveList<std::string>::iterator pos = list.begin();
+            std::advance(pos, offset);
+            AdaptiveList<std::string>::iterator result = list.erase(pos);
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(offset));
+            if (offset == model.size()) {
+                STRESS_CHECK(result == list.end());
+            }
+            else {
+                STRESS_CHECK(*result == model[offset]);
+            }
+            break;
+        }
+        case 3: {
+            std::string value = std::to_string(serial++);
+            list.push_front(value);
+            model.insert(model.begin(), value);
+            break;
+        }
+        case 4:
+            if (model.size() > 1) {
+                list.pop_front();
+                model.erase(model.begin());
+            }
+            break;
+        default: {
+            std::string value = std::to_string(serial++);
+            list.push_back(value);
+            model.push_back(value);
+            break;
+        }
+        }
+        if (was_contiguous != list.is_contiguous() && (r % 6) < 3) {
+            ++switches.inside_edit;
+        }
+        note_switch(was_contiguous, list, switches);
+    }
+}
+
+// Index accesses, scans and appends, which favour contiguous storage.
+void scan_phase(AdaptiveList<std::string>& list, std::vector<std::string>& model, Random& random,
+                std::uint64_t operations, std::uint64_t& serial, Switches& switches) {
+    for (std::uint64_t n = 0; n < operations; ++n) {
+        std::uint64_t r = random.next();
+        bool was_contiguous = list.is_contiguous();
+        switch (r % 4) {
+        case 0: {
+            std::size_t index = 0;
+            for (std::string& value : list) {
+                STRESS_CHECK(value == model[index]);
+                ++index;
+            }
+            STRESS_CHECK(index == model.size());
+            break;
+        }
+        case 1: {
+            std::string value = std::to_string(serial++);
+            list.push_back(value);
+            model.push_back(value);
+            break;
+        }
+        case 2:
+            if (model.size() > 1) {
+                list.pop_back();
+                model.pop_back();
+            }
+            break;
+        default: {
+            std::size_t index = (r >> 8) % model.size();
+            STRESS_CHECK(list[index] == model[index]);
+            STRESS_CHECK(list.at(index) == model[index]);
+            break;
+        }
+        }
+        note_switch(was_contiguous, list, switches);
+    }
+}
+
+struct FragileCopy {
+    static int copies_left;
+    int value;
+
+    explicit FragileCopy(int v) : value(v) {}
+    FragileCopy(const FragileCopy& other) : value(other.value) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    // Not noexcept, so conversions copy rather than move.
+    FragileCopy(FragileCopy&& other) : value(other.value) {}
+    FragileCopy& operator=(const FragileCopy&) = default;
+};
+
+int FragileCopy::copies_left = -1;
+
+void run_failed_conversion() {
+    AdaptiveList<FragileCopy> list;
+    for (int i = 0; i < 100; ++i) {
+        list.emplace_back(i);
+    }
+    FragileCopy::copies_left = 50;
+    bool thrown = false;
+    try {
+        list.make_linked();
+    }
+    catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    FragileCopy::copies_left = -1;
+    STRESS_CHECK(thrown);
+    STRESS_CHECK(list.is_contiguous() && list.getSize() == 100);
+    int expected = 0;
+    for (AdaptiveList<FragileCopy>::iterator it = list.begin(); it != list.end(); ++it) {
+        STRESS_CHECK(it->value == expected);
+        ++expected;
+    }
+    list.make_linked();
+    STRESS_CHECK(!list.is_contiguous() && list.getSize() == 100);
+    for (int i = 0; i < 100; ++i) {
+        STRESS_CHECK(list[i].value == i);
+    }
+}
+
+void run_const_reads() {
+    AdaptiveList<std::string> list;
+    std::vector<std::string> model;
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(std::to_string(i));
+        model.push_back(std::to_string(i));
+    }
+    list.make_linked();
+    const AdaptiveList<std::string>& reader = list;
+    for (int pass = 0; pass < 4; ++pass) {
+        check_equal(reader, model);
+    }
+    // A scan through the non-const list would have filled the window and converted it here.
+    list.push_back("tail");
+    model.push_back("tail");
+    STRESS_CHECK(!list.is_contiguous());
+    check_equal(list, model);
+    list.make_contiguous();
+    STRESS_CHECK(list.is_contiguous());
+    check_equal(list, model);
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000;
+    AdaptiveList<std::string> list;
+    std::vector<std::string> model;
+    Random random{0x9e3779b97f4a7c15ULL};
+    std::uint64_t serial = 0;
+    Switches switches;
+    for (int i = 0; i < 200; ++i) {
+        list.push_back(std::to_string(serial));
+        model.push_back(std::to_string(serial++));
+    }
+    for (int round = 0; round < 6; ++round) {
+        edit_phase(list, model, random, operations, serial, switches);
+        check_equal(list, model);
+        STRESS_CHECK(!list.is_contiguous());
+        scan_phase(list, model, random, operations / 20, serial, switches);
+        check_equal(list, model);
+        STRESS_CHECK(list.is_contiguous());
+    }
+    STRESS_CHECK(switches.to_linked >= 6 && switches.to_contiguous >= 6);
+    STRESS_CHECK(switches.inside_edit > 0);
+
+    list.make_linked();
+    check_equal(list, model);
+    list.make_contiguous();
+    check_equal(list, model);
+    list.clear();
+    model.clear();
+    check_equal(list, model);
+    STRESS_CHECK(list.is_contiguous());
+
+    run_failed_conversion();
+    run_const_reads();
+    std::puts("adaptiveListTest: ok");
+    return 0;
+}
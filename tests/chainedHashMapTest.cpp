@@ -0,0 +1,201 @@
+#include "chainedHashMapHeader.hpp"
+#include "stressCheck.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Runs a ChainedHashMap through randomized inserts, assignments and erases and checks every result
+// against a std::unordered_map model. Whenever an incremental rehash is in progress, every key is
+// looked up with find, contains and find_batch, for_each must visit every pair exactly once, and
+// erases are checked against keys on both sides of the rehash. The map is then copied, moved,
+// swapped and cleared mid-rehash. A second hash maps four keys to each hash value, so chains hold
+// several nodes that are relinked together.
+
+namespace {
+
+struct Random {
+    std::uint64_t state;
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+struct ClusteredHash {
+    std::size_t operator()(std::uint64_t key) const {
+        return static_cast<std::size_t>(key >> 2);
+    }
+};
+
+using Model = std::unordered_map<std::uint64_t, std::uint64_t>;
+
+template <typename Map>
+void check_map(Map& map, const Model& model, std::uint64_t key_space) {
+    STRESS_CHECK(map.getSize() == model.size());
+    STRESS_CHECK(map.empty() == model.empty());
+    const Map& reader = map;
+
+    std::vector<std::uint64_t> keys;
+    for (std::uint64_t key = 0; key < key_space; ++key) {
+        Model::const_iterator expected = model.find(key);
+        const std::uint64_t* value = reader.find(key);
+        if (expected == model.end()) {
+            STRESS_CHECK(value == nullptr && !reader.contains(key));
+        }
+        else {
+            STRESS_CHECK(value && *value == expected->second && reader.contains(key));
+            STRESS_CHECK(map.find(key) == value);
+        }
+        keys.push_back(key);
+    }
+
+    std::vector<std::uint64_t*> results(keys.size(), nullptr);
+    map.find_batch(std::span<const std::uint64_t>(keys), std::span<std::uint64_t*>(results));
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        STRESS_CHECK(results[i] == map.find(keys[i]));
+    }
+
+    std::vector<char> visited(key_space, 0);
+    std::size_t seen = 0;
+    reader.for_each([&](const std::uint64_t& key, const std::uint64_t& value) {
+        STRESS_CHECK(key < key_space && !visited[key]);
+        Model::const_iterator expected = model.find(key);
+        STRESS_CHECK(expected != model.end() && expected->second == value);
+        visited[key] = 1;
+        ++seen;
+    });
+    STRESS_CHECK(seen == model.size());
+}
+
+// Bumps every value through the mutable for_each, which must reach each pair once.
+template <typename Map>
+void bump_values(Map& map, Model& model) {
+    std::size_t seen = 0;
+    map.for_each([&](const std::uint64_t& key, std::uint64_t& value) {
+        value += 1;
+        model[key] += 1;
+        ++seen;
+    });
+    STRESS_CHECK(seen == model.size());
+}
+
+template <typename Map>
+void run(std::uint64_t operations, std::uint64_t key_space, std::uint64_t seed) {
+    Map map;
+    Model model;
+    Random random{seed};
+    std::size_t rehashing_checks = 0;
+    std::size_t rehashing_erases = 0;
+    bool was_rehashing = false;
+
+    for (std::uint64_t n = 0; n < operations; ++n) {
+        std::uint64_t r = random.next();
+        std::uint64_t key = (r >> 16) % key_space;
+        std::uint64_t value = r >> 40;
+        // Grow for the first half of each stretch of 4096 operations, shrink for the second.
+        bool grow = (n & 4096) == 0;
+        switch (r % 8) {
+        case 0:
+        case 1:
+        case 2:
+            if (grow) {
+                bool inserted = map.insert(key, value);
+                STRESS_CHECK(inserted == model.emplace(key, value).second);
+            }
+            else {
+                bool rehashing = map.rehashing();
+                bool erased = map.erase(key);
+                STRESS_CHECK(erased == (model.erase(key) == 1));
+                rehashing_erases += rehashing && erased;
+            }
+            break;
+        case 3: {
+            std::pair<std::uint64_t*, bool> result = map.try_emplace(key, value);
+            std::pair<Model::iterator, bool> expected = model.try_emplace(key, value);
+            STRESS_CHECK(result.second == expected.second && *result.first == expected.first->second);
+            break;
+        }
+        case 4: {
+            bool inserted = map.insert_or_assign(key, value);
+            STRESS_CHECK(inserted == (model.count(key) == 0));
+            model[key] = value;
+            break;
+        }
+        case 5:
+            map[key] += value;
+            model[key] += value;
+            break;
+        case 6: {
+            bool rehashing = map.rehashing();
+            bool erased = map.erase(key);
+            STRESS_CHECK(erased == (model.erase(key) == 1));
+            rehashing_erases += rehashing && erased;
+            break;
+        }
+        default: {
+            std::uint64_t* found = map.find(key);
+            Model::const_iterator expected = model.find(key);
+            STRESS_CHECK((found != nullptr) == (expected != model.end()));
+            if (found) {
+                STRESS_CHECK(*found == expected->second);
+            }
+            break;
+        }
+        }
+
+        // Lookups and for_each do not advance the rehash, so a full check sees it still in progress.
+        if (map.rehashing() && !was_rehashing) {
+            check_map(map, model, key_space);
+            STRESS_CHECK(map.rehashing());
+            bump_values(map, model);
+            STRESS_CHECK(map.rehashing());
+            ++rehashing_checks;
+        }
+        was_rehashing = map.rehashing();
+    }
+    check_map(map, model, key_space);
+    STRESS_CHECK(rehashing_checks > 0 && rehashing_erases > 0);
+
+    // Refill until a rehash starts, then copy, move and swap the map while it is in progress.
+    map.clear();
+    model.clear();
+    std::uint64_t key = 0;
+    while (!map.rehashing()) {
+        map.insert_or_assign(key, key);
+        model[key] = key;
+        ++key;
+    }
+    Map copy(map);
+    STRESS_CHECK(!copy.rehashing());
+    check_map(copy, model, key_space);
+    Map moved(std::move(map));
+    STRESS_CHECK(moved.rehashing());
+    check_map(moved, model, key_space);
+    map.swap(moved);
+    check_map(map, model, key_space);
+    STRESS_CHECK(moved.empty());
+    moved = copy;
+    check_map(moved, model, key_space);
+    map.clear();
+    STRESS_CHECK(!map.rehashing());
+    Model empty;
+    check_map(map, empty, key_space);
+    map = std::move(moved);
+    check_map(map, model, key_space);
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    run<ChainedHashMap<std::uint64_t, std::uint64_t>>(operations, 8192, 0x9e3779b97f4a7c15ULL);
+    run<ChainedHashMap<std::uint64_t, std::uint64_t, ClusteredHash>>(operations, 8192, 0x2545f4914f6cdd1dULL);
+    std::puts("chainedHashMapTest: ok");
+    return 0;
+}
@@ -0,0 +1,173 @@
+#include "concurrentSkipListMapHeader.hpp"
+#include "stressCheck.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Writers insert and erase keys from their own stripe while every thread looks keys up and
+// scans ranges. Values are a function of the key, so any value read must match its key, and
+// scans must always come back strictly ordered. A contended phase then has all threads race on
+// one small key range and checks that successful inserts minus successful erases equals the
+// final size.
+
+namespace {
+
+constexpr int threads_count = 4;
+
+std::uint64_t value_of(std::uint64_t key) {
+    return key * 7 + 1;
+}
+
+struct Random {
+    std::uint64_t state;
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+void run_striped(std::uint64_t key_space, std::uint64_t operations) {
+    ConcurrentSkipListMap<std::uint64_t, std::uint64_t> map;
+    std::vector<std::vector<char>> present(threads_count, std::vector<char>(key_space, 0));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&, t] {
+            Random random{0x9e3779b97f4a7c15ULL * (t + 1)};
+            std::vector<char>& own = present[t];
+            for (std::uint64_t n = 0; n < operations; ++n) {
+                std::uint64_t r = random.next();
+                std::uint64_t key = (r >> 8) % key_space;
+                switch (r % 8) {
+                case 0:
+                case 1:
+                case 2: {
+                    std::uint64_t mine = key - key % threads_count + t;
+                    if (mine >= key_space) {
+                        break;
+                    }
+                    bool inserted = map.insert(mine, value_of(mine));
+                    STRESS_CHECK(inserted == !own[mine]);
+                    own[mine] = 1;
+                    break;
+                }
+                case 3:
+                case 4: {
+                    std::uint64_t mine = key - key % threads_count + t;
+                    if (mine >= key_space) {
+                        break;
+                    }
+                    bool erased = map.erase(mine);
+                    STRESS_CHECK(erased == static_cast<bool>(own[mine]));
+                    own[mine] = 0;
+                    break;
+                }
+                case 5:
+                case 6: {
+                    std::optional<std::uint64_t> value = map.find(key);
+                    if (value) {
+                        STRESS_CHECK(*value == value_of(key));
+                    }
+                    if (key % threads_count == static_cast<std::uint64_t>(t)) {
+                        STRESS_CHECK(value.has_value() == static_cast<bool>(own[key]));
+                        STRESS_CHECK(map.contains(key) == static_cast<bool>(own[key]));
+                    }
+                    break;
+                }
+                default: {
+                    std::uint64_t last = key + 64;
+                    bool first = true;
+                    std::uint64_t previous = 0;
+                    map.for_each_in(key, last, [&](const std::uint64_t& k, const std::uint64_t& v) {
+                        STRESS_CHECK(k >= key && k < last);
+                        STRESS_CHECK(first || k > previous);
+                        STRESS_CHECK(v == value_of(k));
+                        first = false;
+                        previous = k;
+                    });
+                    break;
+                }
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::size_t expected = 0;
+    for (const std::vector<char>& own : present) {
+        for (char bit : own) {
+            expected += bit;
+        }
+    }
+    STRESS_CHECK(map.getSize() == expected);
+    std::size_t seen = 0;
+    std::uint64_t previous = 0;
+    map.for_each([&](const std::uint64_t& k, const std::uint64_t& v) {
+        STRESS_CHECK(seen == 0 || k > previous);
+        STRESS_CHECK(present[k % threads_count][k]);
+        STRESS_CHECK(v == value_of(k));
+        previous = k;
+        ++seen;
+    });
+    STRESS_CHECK(seen == expected);
+}
+
+void run_contended(std::uint64_t key_space, std::uint64_t operations) {
+    ConcurrentSkipListMap<std::uint64_t, std::uint64_t> map;
+    std::atomic<std::int64_t> balance{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&, t] {
+            Random random{0x2545f4914f6cdd1dULL * (t + 1)};
+            std::int64_t local = 0;
+            for (std::uint64_t n = 0; n < operations; ++n) {
+                std::uint64_t r = random.next();
+                std::uint64_t key = (r >> 8) % key_space;
+                if (r & 1) {
+                    local += map.insert(key, value_of(key));
+                }
+                else {
+                    local -= map.erase(key);
+                }
+                if (std::optional<std::uint64_t> value = map.find(key)) {
+                    STRESS_CHECK(*value == value_of(key));
+                }
+            }
+            balance.fetch_add(local);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    STRESS_CHECK(balance.load() >= 0);
+    STRESS_CHECK(map.getSize() == static_cast<std::size_t>(balance.load()));
+    std::size_t seen = 0;
+    map.for_each([&](const std::uint64_t& k, const std::uint64_t& v) {
+        STRESS_CHECK(k < key_space && v == value_of(k));
+        ++seen;
+    });
+    STRESS_CHECK(seen == map.getSize());
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    for (int round = 0; round < 3; ++round) {
+        run_striped(4096, operations);
+        run_contended(64, operations);
+    }
+    EpochReclaimer::collect();
+    STRESS_CHECK(EpochReclaimer::pending() == 0);
+    std::puts("concurrentSkipListMapStress: ok");
+    return 0;
+}
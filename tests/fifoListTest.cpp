@@ -0,0 +1,236 @@
+#include "fifoListHeader.hpp"
+#include "stressCheck.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+
+// Runs a FifoList through queue traffic and randomized edits and checks it against a std::deque
+// model. Queue phases push at one end and pop at the other, so rings fill, overflow into spares
+// and empty again; edit phases insert and erase in the middle, which splits full rings. Elements
+// count their live instances and carry a canary, so a slot read after its element was destroyed,
+// or an element destroyed twice or never, is caught even though rings come from the slab pool.
+
+namespace {
+
+struct Random {
+    std::uint64_t state;
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+constexpr std::uint64_t alive_canary = 0xa11ce5a11ce5a11cULL;
+
+struct Tracked {
+    static std::int64_t live;
+    std::int64_t value;
+    std::uint64_t canary;
+
+    explicit Tracked(std::int64_t v) : value(v), canary(alive_canary) {
+        ++live;
+    }
+    Tracked(const Tracked& other) : value(other.get()), canary(alive_canary) {
+        ++live;
+    }
+    Tracked(Tracked&& other) noexcept : value(other.get()), canary(alive_canary) {
+        ++live;
+    }
+    Tracked& operator=(const Tracked& other) {
+        value = other.get();
+        return *this;
+    }
+    Tracked& operator=(Tracked&& other) noexcept {
+        value = other.get();
+        return *this;
+    }
+    ~Tracked() {
+        STRESS_CHECK(canary == alive_canary);
+        canary = 0;
+        --live;
+    }
+    std::int64_t get() const {
+        STRESS_CHECK(canary == alive_canary);
+        return value;
+    }
+};
+
+std::int64_t Tracked::live = 0;
+
+void check_equal(FifoList<Tracked>& list, const std::deque<std::int64_t>& model) {
+    STRESS_CHECK(list.getSize() == model.size());
+    STRESS_CHECK(list.empty() == model.empty());
+    const FifoList<Tracked>& reader = list;
+    std::size_t index = 0;
+    for (FifoList<Tracked>::const_iterator it = reader.cbegin(); it != reader.cend(); ++it) {
+        STRESS_CHECK(index < model.size() && it->get() == model[index]);
+        ++index;
+    }
+    STRESS_CHECK(index == model.size());
+    FifoList<Tracked>::const_iterator back = reader.cend();
+    while (index > 0) {
+        --back;
+        --index;
+        STRESS_CHECK(back->get() == model[index]);
+    }
+    STRESS_CHECK(back == reader.cbegin());
+    FifoList<Tracked>::iterator it = list.end();
+    for (std::size_t i = model.size(); i > 0; --i) {
+        --it;
+        STRESS_CHECK(it->get() == model[i - 1]);
+    }
+    STRESS_CHECK(it == list.begin());
+    if (!model.empty()) {
+        STRESS_CHECK(reader.front().get() == model.front() && reader.back().get() == model.back());
+    }
+}
+
+// Pushes at one end and pops at the other, keeping the size within [low, high).
+void queue_phase(FifoList<Tracked>& list, std::deque<std::int64_t>& model, Random& random,
+                 std::uint64_t operations, std::size_t low, std::size_t high, std::int64_t& serial) {
+    bool forward = random.next() & 1;
+    for (std::uint64_t n = 0; n < operations; ++n) {
+        std::uint64_t r = random.next();
+        bool push = model.size() < low || (model.size() + 1 < high && (r & 1));
+        if (push) {
+            std::int64_t value = serial++;
+            if (forward) {
+                if (r & 2) {
+                    list.push_back(Tracked(value));
+                }
+                else {
+                    STRESS_CHECK(list.emplace_back(value).get() == value);
+                }
+                model.push_back(value);
+            }
+            else {
+                if (r & 2) {
+                    Tracked element(value);
+                    list.push_front(element);
+                }
+                else {
+                    STRESS_CHECK(list.emplace_front(value).get() == value);
+                }
+                model.push_front(value);
+            }
+        }
+        else if (!model.empty()) {
+            if (forward) {
+                STRESS_CHECK(list.front().get() == model.front());
+                list.pop_front();
+                model.pop_front();
+            }
+            else {
+                STRESS_CHECK(list.back().get() == model.back());
+                list.pop_back();
+                model.pop_back();
+            }
+        }
+        STRESS_CHECK(list.getSize() == model.size());
+        STRESS_CHECK(static_cast<std::size_t>(Tracked::live) == model.size());
+    }
+}
+
+FifoList<Tracked>::iterator position(FifoList<Tracked>& list, std::size_t offset) {
+    FifoList<Tracked>::iterator it = list.begin();
+    std::advance(it, static_cast<std::ptrdiff_t>(offset));
+    return it;
+}
+
+// Inserts, erases and overwrites at random positions while the size drifts towards `target`.
+void edit_phase(FifoList<Tracked>& list, std::deque<std::int64_t>& model, Random& random,
+                std::uint64_t operations, std::size_t target, std::int64_t& serial) {
+    for (std::uint64_t n = 0; n < operations; ++n) {
+        std::uint64_t r = random.next();
+        std::size_t offset = (r >> 32) % (model.size() + 1);
+        switch ((r >> 4) % 5) {
+        case 0:
+        case 1: {
+            if (model.size() >= target && (r & 1)) {
+                break;
+            }
+            std::int64_t value = serial++;
+            FifoList<Tracked>::iterator result = list.insert(position(list, offset), Tracked(value));
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(offset), value);
+            STRESS_CHECK(result->get() == value);
+            if (offset > 0) {
+                STRESS_CHECK(std::prev(result)->get() == model[offset - 1]);
+            }
+            if (offset + 1 < model.size()) {
+                STRESS_CHECK(std::next(result)->get() == model[offset + 1]);
+            }
+            break;
+        }
+        case 2:
+        case 3: {
+            if (model.empty() || (model.size() < target && (r & 1))) {
+                break;
+            }
+            offset %= model.size();
+            FifoList<Tracked>::iterator result = list.erase(position(list, offset));
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(offset));
+            if (offset == model.size()) {
+                STRESS_CHECK(result == list.end());
+            }
+            else {
+                STRESS_CHECK(result->get() == model[offset]);
+            }
+            break;
+        }
+        default:
+            if (!model.empty()) {
+                offset %= model.size();
+                std::int64_t value = serial++;
+                *position(list, offset) = Tracked(value);
+                model[offset] = value;
+            }
+            break;
+        }
+        STRESS_CHECK(static_cast<std::size_t>(Tracked::live) == model.size());
+    }
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    {
+        FifoList<Tracked> list;
+        std::deque<std::int64_t> model;
+        Random random{0x9e3779b97f4a7c15ULL};
+        std::int64_t serial = 0;
+        for (int round = 0; round < 8; ++round) {
+            queue_phase(list, model, random, operations, 0, 5, serial);
+            check_equal(list, model);
+            queue_phase(list, model, random, operations, 20, 70, serial);
+            check_equal(list, model);
+            edit_phase(list, model, random, operations / 4, 300, serial);
+            check_equal(list, model);
+            edit_phase(list, model, random, operations / 4, 30, serial);
+            check_equal(list, model);
+            if (round % 3 == 2) {
+                list.clear();
+                model.clear();
+                check_equal(list, model);
+                STRESS_CHECK(Tracked::live == 0);
+            }
+        }
+        while (!model.empty()) {
+            list.pop_front();
+            model.pop_front();
+        }
+        check_equal(list, model);
+        for (int i = 0; i < 100; ++i) {
+            list.push_back(Tracked(i));
+            model.push_back(i);
+        }
+        check_equal(list, model);
+    }
+    STRESS_CHECK(Tracked::live == 0);
+    std::puts("fifoListTest: ok");
+    return 0;
+}
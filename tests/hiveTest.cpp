@@ -0,0 +1,240 @@
+#include "hiveHeader.hpp"
+#include "stressCheck.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Runs a Hive through randomized inserts and erases and checks it against a model of which values
+// it holds and where each one lives. Erases hit single elements, consecutive runs that the
+// skipfield has to merge, and whole blocks, which are freed. After each phase the hive is walked
+// forward and backward with both iterator types; every element must be visited once, in the same
+// order both ways, at the address it was inserted at. Elements carry a canary at their start, where
+// an erased slot's free-list links are written, so visiting an erased slot fails the test.
+
+namespace {
+
+struct Random {
+    std::uint64_t state;
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+constexpr std::uint64_t alive_canary = 0xa11ce5a11ce5a11cULL;
+
+struct Tracked {
+    static std::int64_t live;
+    std::uint64_t canary;
+    std::int64_t value;
+
+    explicit Tracked(std::int64_t v) : canary(alive_canary), value(v) {
+        ++live;
+    }
+    Tracked(const Tracked& other) : canary(alive_canary), value(other.get()) {
+        ++live;
+    }
+    Tracked& operator=(const Tracked& other) {
+        value = other.get();
+        return *this;
+    }
+    ~Tracked() {
+        STRESS_CHECK(canary == alive_canary);
+        canary = 0;
+        --live;
+    }
+    std::int64_t get() const {
+        STRESS_CHECK(canary == alive_canary);
+        return value;
+    }
+};
+
+std::int64_t Tracked::live = 0;
+
+// The expected contents: each value's address, and an iterator to it for random erases.
+struct Model {
+    std::unordered_map<std::int64_t, const Tracked*> address;
+    std::vector<Hive<Tracked>::iterator> handles;
+    std::unordered_map<std::int64_t, std::size_t> handle_of;
+
+    void add(Hive<Tracked>::iterator it) {
+        STRESS_CHECK(address.emplace(it->get(), &*it).second);
+        handle_of[it->get()] = handles.size();
+        handles.push_back(it);
+    }
+
+    void remove(std::int64_t value) {
+        STRESS_CHECK(address.erase(value) == 1);
+        std::size_t index = handle_of[value];
+        handle_of.erase(value);
+        if (index + 1 != handles.size()) {
+            handles[index] = handles.back();
+            handle_of[handles[index]->get()] = index;
+        }
+        handles.pop_back();
+    }
+
+    void clear() {
+        address.clear();
+        handles.clear();
+        handle_of.clear();
+    }
+};
+
+void check_hive(Hive<Tracked>& hive, const Model& model) {
+    STRESS_CHECK(hive.getSize() == model.address.size());
+    STRESS_CHECK(hive.empty() == model.address.empty());
+    STRESS_CHECK(hive.capacity() >= hive.getSize());
+    STRESS_CHECK(static_cast<std::size_t>(Tracked::live) == model.address.size());
+
+    std::vector<const Tracked*> forward;
+    for (Hive<Tracked>::iterator it = hive.begin(); it != hive.end(); ++it) {
+        auto found = model.address.find(it->get());
+        STRESS_CHECK(found != model.address.end() && found->second == &*it);
+        forward.push_back(&*it);
+    }
+    STRESS_CHECK(forward.size() == model.address.size());
+    std::vector<const Tracked*> sorted(forward);
+    std::sort(sorted.begin(), sorted.end());
+    STRESS_CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+    std::size_t index = forward.size();
+    Hive<Tracked>::iterator back = hive.end();
+    while (index > 0) {
+        --back;
+        --index;
+        STRESS_CHECK(&*back == forward[index]);
+    }
+    STRESS_CHECK(back == hive.begin());
+
+    const Hive<Tracked>& reader = hive;
+    index = 0;
+    for (Hive<Tracked>::const_iterator it = reader.cbegin(); it != reader.cend(); ++it) {
+        STRESS_CHECK(index < forward.size() && &*it == forward[index]);
+        ++index;
+    }
+    STRESS_CHECK(index == forward.size());
+    Hive<Tracked>::const_iterator cback = reader.end();
+    while (index > 0) {
+        cback--;
+        --index;
+        STRESS_CHECK(&*cback == forward[index]);
+    }
+    STRESS_CHECK(cback == reader.begin());
+}
+
+// Erases through `it` and checks that the returned iterator is the element that followed it.
+Hive<Tracked>::iterator erase_checked(Hive<Tracked>& hive, Model& model, Hive<Tracked>::iterator it,
+                                      bool through_const) {
+    Hive<Tracked>::iterator following = std::next(it);
+    std::int64_t value = it->get();
+    Hive<Tracked>::iterator result = through_const ? hive.erase(Hive<Tracked>::const_iterator(it)) : hive.erase(it);
+    model.remove(value);
+    STRESS_CHECK(result == following);
+    return result;
+}
+
+void insert_checked(Hive<Tracked>& hive, Model& model, std::int64_t value, bool emplace) {
+    Hive<Tracked>::iterator it = emplace ? hive.emplace(value) : hive.insert(Tracked(value));
+    STRESS_CHECK(it->get() == value);
+    model.add(it);
+}
+
+// Inserts and erases single elements at random while the size drifts towards `target`.
+void scatter_phase(Hive<Tracked>& hive, Model& model, Random& random, std::uint64_t operations,
+                   std::size_t target, std::int64_t& serial) {
+    for (std::uint64_t n = 0; n < operations; ++n) {
+        std::uint64_t r = random.next();
+        bool grow = model.handles.size() < target;
+        if (model.handles.empty() || (r % 4 != 0) == grow) {
+            insert_checked(hive, model, serial++, r & 0x10);
+        }
+        else {
+            std::size_t index = (r >> 32) % model.handles.size();
+            erase_checked(hive, model, model.handles[index], r & 0x20);
+        }
+    }
+}
+
+// Erases runs of consecutive elements, which the skipfield merges with the erased runs around them.
+void run_phase(Hive<Tracked>& hive, Model& model, Random& random, std::uint64_t runs, std::size_t longest) {
+    for (std::uint64_t n = 0; n < runs && !model.handles.empty(); ++n) {
+        std::uint64_t r = random.next();
+        Hive<Tracked>::iterator it = model.handles[(r >> 32) % model.handles.size()];
+        std::size_t length = 1 + (r >> 8) % longest;
+        for (std::size_t i = 0; i < length && it != hive.end(); ++i) {
+            it = erase_checked(hive, model, it, (r >> (i % 64)) & 1);
+        }
+    }
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+    {
+        Hive<Tracked> hive;
+        Model model;
+        Random random{0x9e3779b97f4a7c15ULL};
+        std::int64_t serial = 0;
+        for (int round = 0; round < 6; ++round) {
+            scatter_phase(hive, model, random, operations, 4000, serial);
+            check_hive(hive, model);
+            run_phase(hive, model, random, operations / 100, 40);
+            check_hive(hive, model);
+            run_phase(hive, model, random, 4, 2000);
+            check_hive(hive, model);
+            scatter_phase(hive, model, random, operations / 2, 4000, serial);
+            check_hive(hive, model);
+            // Draining to a handful of elements frees most blocks, leaving gaps between survivors.
+            std::size_t full_capacity = hive.capacity();
+            scatter_phase(hive, model, random, operations, 10, serial);
+            check_hive(hive, model);
+            STRESS_CHECK(hive.capacity() < full_capacity);
+        }
+
+        {
+            // The copy is compact, so it holds the same values in freshly packed blocks.
+            Hive<Tracked> copy(hive);
+            STRESS_CHECK(copy.getSize() == hive.getSize());
+            STRESS_CHECK(static_cast<std::size_t>(Tracked::live) == 2 * hive.getSize());
+            std::vector<std::int64_t> original_values;
+            std::vector<std::int64_t> copied_values;
+            for (const Tracked& element : hive) {
+                original_values.push_back(element.get());
+            }
+            for (const Tracked& element : copy) {
+                copied_values.push_back(element.get());
+            }
+            std::sort(original_values.begin(), original_values.end());
+            std::sort(copied_values.begin(), copied_values.end());
+            STRESS_CHECK(original_values == copied_values);
+        }
+
+        Hive<Tracked> moved(std::move(hive));
+        check_hive(moved, model);
+        hive.swap(moved);
+        check_hive(hive, model);
+        STRESS_CHECK(moved.empty());
+
+        while (!model.handles.empty()) {
+            erase_checked(hive, model, model.handles.back(), false);
+        }
+        check_hive(hive, model);
+        scatter_phase(hive, model, random, 100, 50, serial);
+        check_hive(hive, model);
+        hive.clear();
+        model.clear();
+        check_hive(hive, model);
+    }
+    STRESS_CHECK(Tracked::live == 0);
+    std::puts("hiveTest: ok");
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "mpmcListHeader.hpp"
+#include "stressCheck.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Producers push tagged values while consumers pop concurrently. Every value must come out
+// exactly once, each consumer must see every producer's values in push order, and the queue
+// must end empty with all retired segments reclaimable.
+
+namespace {
+
+constexpr int producers = 4;
+constexpr int consumers = 4;
+
+std::uint64_t tag(int producer, std::uint64_t index) {
+    return (std::uint64_t(producer) << 40) | index;
+}
+
+void run_integers(std::uint64_t per_producer) {
+    MpmcList<std::uint64_t> queue;
+    std::unique_ptr<std::atomic<unsigned char>[]> seen(new std::atomic<unsigned char>[producers * per_producer]());
+    std::atomic<std::uint64_t> popped{0};
+    const std::uint64_t total = producers * per_producer;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::uint64_t i = 0; i < per_producer; ++i) {
+                if (i % 3 == 0) {
+                    queue.emplace(tag(p, i));
+                }
+                else {
+                    queue.push(tag(p, i));
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<std::int64_t> last(producers, -1);
+            while (popped.load(std::memory_order_relaxed) < total) {
+                std::uint64_t value;
+                if (!queue.try_pop(value)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                int p = static_cast<int>(value >> 40);
+                std::uint64_t i = value & ((std::uint64_t(1) << 40) - 1);
+                STRESS_CHECK(p >= 0 && p < producers && i < per_producer);
+                STRESS_CHECK(static_cast<std::int64_t>(i) > last[p]);
+                last[p] = static_cast<std::int64_t>(i);
+                STRESS_CHECK(seen[p * per_producer + i].exchange(1) == 0);
+                popped.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    STRESS_CHECK(popped.load() == total);
+    for (std::uint64_t k = 0; k < total; ++k) {
+        STRESS_CHECK(seen[k].load() == 1);
+    }
+    STRESS_CHECK(queue.empty());
+    STRESS_CHECK(queue.getSize() == 0);
+    STRESS_CHECK(!queue.pop());
+}
+
+void run_strings(std::uint64_t per_producer) {
+    std::atomic<std::uint64_t> popped{0};
+    std::atomic<std::uint64_t> length_sum{0};
+    {
+        MpmcList<std::string> queue;
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (std::uint64_t i = 0; i < per_producer; ++i) {
+                    queue.push(std::string(24 + i % 16, static_cast<char>('a' + p)));
+                }
+            });
+        }
+        for (int c = 0; c < consumers / 2; ++c) {
+            threads.emplace_back([&] {
+                for (std::uint64_t n = 0; n < per_producer; ++n) {
+                    std::optional<std::string> value;
+                    while (!(value = queue.pop())) {
+                        std::this_thread::yield();
+                    }
+                    STRESS_CHECK(value->size() >= 24 && value->size() < 40);
+                    STRESS_CHECK(value->find_first_not_of(value->front()) == std::string::npos);
+                    length_sum.fetch_add(value->size(), std::memory_order_relaxed);
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        // Half the values are left behind for the destructor to release.
+        STRESS_CHECK(queue.getSize() == (producers - consumers / 2) * per_producer);
+    }
+    STRESS_CHECK(popped.load() == consumers / 2 * per_producer);
+    STRESS_CHECK(length_sum.load() >= popped.load() * 24);
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t per_producer = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000;
+    for (int round = 0; round < 3; ++round) {
+        run_integers(per_producer);
+        run_strings(per_producer / 4 + 1);
+    }
+    EpochReclaimer::collect();
+    STRESS_CHECK(EpochReclaimer::pending() == 0);
+    std::puts("mpmcListStress: ok");
+    return 0;
+}
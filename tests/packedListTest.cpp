@@ -0,0 +1,220 @@
+#include "packedListHeader.hpp"
+#include "stressCheck.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <vector>
+
+// Runs a PackedList of each lane width through randomized edits and checks it against a
+// std::vector model. A growth phase that inserts in the middle splits full chunks, a shrink phase
+// that erases in the middle leaves them sparse, and shrink_to_fit then repacks them. Between
+// phases the list is walked both ways, count and popcount are compared with the model, and the
+// list must compare equal to copies whose chunks are laid out differently.
+
+namespace {
+
+struct Random {
+    std::uint64_t state;
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+template <typename T>
+T value_from(std::uint64_t r) {
+    // Mostly small values, so count has many matches to find.
+    if (r & 0x100) {
+        return static_cast<T>((r >> 16) % 3);
+    }
+    return static_cast<T>(r >> 16);
+}
+
+template <typename T>
+void check_equal(PackedList<T>& list, const std::vector<T>& model) {
+    STRESS_CHECK(list.getSize() == model.size());
+    STRESS_CHECK(list.empty() == model.empty());
+    const PackedList<T>& reader = list;
+    std::size_t index = 0;
+    for (typename PackedList<T>::const_iterator it = reader.cbegin(); it != reader.cend(); ++it) {
+        STRESS_CHECK(index < model.size() && *it == model[index]);
+        ++index;
+    }
+    STRESS_CHECK(index == model.size());
+    typename PackedList<T>::const_iterator back = reader.cend();
+    while (index > 0) {
+        --back;
+        --index;
+        STRESS_CHECK(*back == model[index]);
+    }
+    STRESS_CHECK(back == reader.cbegin());
+    typename PackedList<T>::iterator it = list.end();
+    for (std::size_t i = model.size(); i > 0; --i) {
+        --it;
+        STRESS_CHECK(static_cast<T>(*it) == model[i - 1]);
+    }
+    STRESS_CHECK(it == list.begin());
+    if (!model.empty()) {
+        STRESS_CHECK(reader.front() == model.front() && reader.back() == model.back());
+    }
+}
+
+template <typename T>
+void check_queries(const PackedList<T>& list, const std::vector<T>& model) {
+    for (std::uint64_t v = 0; v < 4; ++v) {
+        T value = static_cast<T>(v);
+        STRESS_CHECK(list.count(value) == static_cast<std::size_t>(std::count(model.begin(), model.end(), value)));
+    }
+    std::size_t bits = 0;
+    for (T value : model) {
+        bits += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(value)));
+    }
+    STRESS_CHECK(list.popcount() == bits);
+}
+
+// Rebuilds the list from the back with push_front, which lays its chunks out differently.
+template <typename T>
+void check_layouts(const PackedList<T>& list, const std::vector<T>& model) {
+    PackedList<T> copy(list);
+    STRESS_CHECK(copy == list);
+    PackedList<T> reversed;
+    for (typename std::vector<T>::const_reverse_iterator it = model.rbegin(); it != model.rend(); ++it) {
+        reversed.push_front(*it);
+    }
+    STRESS_CHECK(reversed == list && list == reversed);
+    if (!model.empty()) {
+        reversed.pop_front();
+        STRESS_CHECK(!(reversed == list));
+        reversed.push_front(static_cast<T>(!model.front()));
+        STRESS_CHECK(!(reversed == list));
+    }
+}
+
+template <typename T>
+typename PackedList<T>::iterator position(PackedList<T>& list, std::size_t offset) {
+    typename PackedList<T>::iterator it = list.begin();
+    std::advance(it, static_cast<std::ptrdiff_t>(offset));
+    return it;
+}
+
+template <typename T>
+void edit_phase(PackedList<T>& list, std::vector<T>& model, Random& random, std::uint64_t operations,
+                std::size_t target) {
+    for (std::uint64_t n = 0; n < operations; ++n) {
+        std::uint64_t r = random.next();
+        T value = value_from<T>(r);
+        bool grow = model.size() < target;
+        std::size_t offset = model.empty() ? 0 : (r >> 32) % (model.size() + 1);
+        switch ((r >> 4) % 8) {
+        case 0:
+        case 1:
+        case 2: {
+            if (!grow) {
+                break;
+            }
+            typename PackedList<T>::iterator result = list.insert(position(list, offset), value);
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(offset), value);
+            STRESS_CHECK(static_cast<T>(*result) == value);
+            if (offset + 1 < model.size()) {
+                STRESS_CHECK(static_cast<T>(*std::next(result)) == model[offset + 1]);
+            }
+            break;
+        }
+        case 3:
+        case 4: {
+            if (grow || model.empty()) {
+                break;
+            }
+            offset %= model.size();
+            typename PackedList<T>::iterator result = list.erase(position(list, offset));
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(offset));
+            if (offset == model.size()) {
+                STRESS_CHECK(result == list.end());
+            }
+            else {
+                STRESS_CHECK(static_cast<T>(*result) == model[offset]);
+            }
+            break;
+        }
+        case 5:
+            if (r & 0x200) {
+                list.push_back(value);
+                model.push_back(value);
+            }
+            else {
+                list.push_front(value);
+                model.insert(model.begin(), value);
+            }
+            break;
+        case 6:
+            if (model.empty()) {
+                break;
+            }
+            if (r & 0x200) {
+                list.pop_back();
+                model.pop_back();
+            }
+            else {
+                list.pop_front();
+                model.erase(model.begin());
+            }
+            break;
+        default:
+            if (!model.empty()) {
+                offset %= model.size();
+                *position(list, offset) = value;
+                model[offset] = value;
+            }
+            break;
+        }
+    }
+}
+
+template <typename T>
+void run(std::uint64_t operations, std::uint64_t seed) {
+    PackedList<T> list;
+    std::vector<T> model;
+    Random random{seed};
+    for (int round = 0; round < 4; ++round) {
+        edit_phase(list, model, random, operations, 3000);
+        check_equal(list, model);
+        check_queries(list, model);
+        check_layouts(list, model);
+
+        edit_phase(list, model, random, operations, 200);
+        check_equal(list, model);
+        check_queries(list, model);
+        list.shrink_to_fit();
+        check_equal(list, model);
+        check_queries(list, model);
+        check_layouts(list, model);
+    }
+
+    PackedList<T> other{static_cast<T>(1), static_cast<T>(0)};
+    list.swap(other);
+    check_equal(other, model);
+    list = other;
+    check_equal(list, model);
+    list.clear();
+    model.clear();
+    check_equal(list, model);
+    check_queries(list, model);
+    list.shrink_to_fit();
+    check_equal(list, model);
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+    run<bool>(operations, 0x9e3779b97f4a7c15ULL);
+    run<std::uint8_t>(operations, 0x2545f4914f6cdd1dULL);
+    run<std::uint16_t>(operations, 0x5851f42d4c957f2dULL);
+    std::puts("packedListTest: ok");
+    return 0;
+}
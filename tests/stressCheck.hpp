@@ -0,0 +1,16 @@
+#ifndef STRESS_CHECK_H
+#define STRESS_CHECK_H
+
+#include <cstdio>
+#include <cstdlib>
+
+// Unlike assert, stays active in optimized builds.
+#define STRESS_CHECK(condition)                                                              \
+    do {                                                                                     \
+        if (!(condition)) {                                                                  \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            std::abort();                                                                    \
+        }                                                                                    \
+    } while (0)
+
+#endif